@@ -938,6 +938,49 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+static int test_mp_mul_low(void)
+{
+   static const int sizes[] = { 1, 10, 100, 300, 700 };
+   mp_int a, b, c, d;
+   int i, j, k, n;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+
+   EXPECT(mp_mul_low(&a, &b, -1, &c) == MP_VAL);
+
+   for (i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++) {
+      for (j = 0; j < 6; j++) {
+         DO(mp_rand(&a, sizes[i]));
+         DO(mp_rand(&b, (j < 3) ? sizes[i] : MP_MAX(1, sizes[i] / 3)));
+         if ((j % 3) == 1) {
+            a.sign = MP_NEG;
+         }
+         for (k = 0; k < 6; k++) {
+            /* 0, 1, half, all, one less and one more digit than the product */
+            n = (k < 2) ? k : ((k == 2) ? (sizes[i] / 2) : ((k == 3) ? sizes[i] : ((2 * sizes[i]) + (2 * k) - 9)));
+
+            DO(mp_mul(&a, &b, &d));
+            DO(mp_mod_2d(&d, n * MP_DIGIT_BIT, &d));
+            DO(mp_mul_low(&a, &b, n, &c));
+            EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+            /* squares and in place */
+            DO(mp_sqr(&a, &d));
+            DO(mp_mod_2d(&d, n * MP_DIGIT_BIT, &d));
+            DO(mp_copy(&a, &c));
+            DO(mp_mul_low(&c, &c, n, &c));
+            EXPECT(mp_cmp(&c, &d) == MP_EQ);
+         }
+      }
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
 static int test_mp_montgomery_reduce(void)
 {
    mp_digit mp;
@@ -993,6 +1036,21 @@ static int test_mp_montgomery_reduce(void)
       }
    }
 
+   /* worst case for the column sums: all digits of the modulus and of the input maximal */
+   for (i = 1; i < 64; i++) {
+      DO(mp_2expt(&a, i * MP_DIGIT_BIT));
+      DO(mp_decr(&a));
+      DO(mp_montgomery_calc_normalization(&b, &a));
+      DO(mp_montgomery_setup(&a, &mp));
+      DO(mp_mul(&a, &a, &c));
+      DO(mp_add(&c, &a, &c));
+      DO(mp_decr(&c));
+      DO(mp_mod(&c, &a, &d));
+      DO(mp_montgomery_reduce(&c, &a, mp));
+      DO(mp_mulmod(&c, &b, &a, &c));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
    mp_clear_multi(&a, &b, &c, &d, &e, NULL);
    return EXIT_SUCCESS;
 LBL_ERR:
@@ -1001,6 +1059,788 @@ LBL_ERR:
 
 }
 
+static int test_mp_mont_ctx(void)
+{
+   mp_int n, a, b, c, d, e;
+   mp_mont_ctx ctx;
+   bool have_ctx = false;
+   int size;
+
+   DOR(mp_init_multi(&n, &a, &b, &c, &d, &e, NULL));
+
+   /* only odd moduli > 1 */
+   mp_set(&n, 1u);
+   EXPECT(mp_mont_ctx_init(&ctx, &n) == MP_VAL);
+   mp_set(&n, 10u);
+   EXPECT(mp_mont_ctx_init(&ctx, &n) == MP_VAL);
+   mp_set(&n, 11u);
+   DO(mp_neg(&n, &n));
+   EXPECT(mp_mont_ctx_init(&ctx, &n) == MP_VAL);
+
+   for (size = 1; size < 160; size += 1 + (size / 4)) {
+      DO(mp_rand(&n, size));
+      n.dp[0] |= 1u;
+      if (mp_cmp_d(&n, 1u) == MP_EQ) {
+         mp_set(&n, 3u);
+      }
+      DO(mp_mont_ctx_init(&ctx, &n));
+      have_ctx = true;
+
+      DO(mp_rand(&a, size));
+      DO(mp_mod(&a, &n, &a));
+      DO(mp_rand(&b, size + 1));
+      b.sign = MP_NEG;
+
+      /* into and out of Montgomery form, any value can be converted */
+      DO(mp_to_mont(&a, &ctx, &c));
+      DO(mp_from_mont(&c, &ctx, &d));
+      EXPECT(mp_cmp(&a, &d) == MP_EQ);
+      DO(mp_to_mont(&b, &ctx, &d));
+      DO(mp_from_mont(&d, &ctx, &d));
+      DO(mp_mod(&b, &n, &b));
+      EXPECT(mp_cmp(&b, &d) == MP_EQ);
+
+      /* products */
+      DO(mp_to_mont(&b, &ctx, &d));
+      DO(mp_mont_mul(&c, &d, &ctx, &d));
+      DO(mp_from_mont(&d, &ctx, &d));
+      DO(mp_mulmod(&a, &b, &n, &e));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      DO(mp_mont_sqr(&c, &ctx, &d));
+      DO(mp_from_mont(&d, &ctx, &d));
+      DO(mp_sqrmod(&a, &n, &e));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+
+      /* powers */
+      DO(mp_rand(&e, (size % 7) + 1));
+      DO(mp_mont_exp(&c, &e, &ctx, &d));
+      DO(mp_from_mont(&d, &ctx, &d));
+      DO(mp_exptmod(&a, &e, &n, &b));
+      EXPECT(mp_cmp(&d, &b) == MP_EQ);
+      mp_zero(&e);
+      DO(mp_mont_exp(&c, &e, &ctx, &d));
+      EXPECT(mp_cmp(&d, &ctx.R) == MP_EQ);
+      mp_set(&e, 1u);
+      DO(mp_mont_exp(&c, &e, &ctx, &d));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+      e.sign = MP_NEG;
+      EXPECT(mp_mont_exp(&c, &e, &ctx, &d) == MP_VAL);
+
+      mp_mont_ctx_clear(&ctx);
+      have_ctx = false;
+   }
+
+   mp_clear_multi(&n, &a, &b, &c, &d, &e, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   if (have_ctx) {
+      mp_mont_ctx_clear(&ctx);
+   }
+   mp_clear_multi(&n, &a, &b, &c, &d, &e, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_barrett_ctx(void)
+{
+   mp_int n, a, b, c, d, e;
+   mp_barrett_ctx ctx;
+   bool have_ctx = false;
+   int size;
+
+   DOR(mp_init_multi(&n, &a, &b, &c, &d, &e, NULL));
+
+   /* only moduli > 0 */
+   mp_zero(&n);
+   EXPECT(mp_barrett_ctx_init(&ctx, &n) == MP_VAL);
+   mp_set(&n, 11u);
+   DO(mp_neg(&n, &n));
+   EXPECT(mp_barrett_ctx_init(&ctx, &n) == MP_VAL);
+
+   for (size = 1; size < 160; size += 1 + (size / 4)) {
+      DO(mp_rand(&n, size));
+      if ((size % 3) == 0) {
+         n.dp[0] &= ~(mp_digit)1;
+      }
+      if (size == 1) {
+         mp_set(&n, 1u);
+      }
+      DO(mp_barrett_ctx_init(&ctx, &n));
+      have_ctx = true;
+
+      /* any value, negative, larger than N**2 or already reduced */
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, 2 * size));
+      DO(mp_rand(&c, 3 * size));
+      DO(mp_barrett_mod(&a, &ctx, &d));
+      DO(mp_mod(&a, &n, &e));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      DO(mp_barrett_mod(&b, &ctx, &d));
+      DO(mp_mod(&b, &n, &e));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      DO(mp_barrett_mod(&c, &ctx, &d));
+      DO(mp_mod(&c, &n, &e));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      b.sign = MP_NEG;
+      DO(mp_barrett_mod(&b, &ctx, &d));
+      DO(mp_mod(&b, &n, &e));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+      DO(mp_barrett_mod(&e, &ctx, &d));
+      EXPECT(mp_cmp(&d, &e) == MP_EQ);
+
+      /* sums and products of reduced and unreduced values */
+      DO(mp_mod(&a, &n, &a));
+      DO(mp_barrett_addmod(&a, &e, &ctx, &d));
+      DO(mp_addmod(&a, &e, &n, &c));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+      DO(mp_barrett_addmod(&a, &b, &ctx, &d));
+      DO(mp_addmod(&a, &b, &n, &c));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+      DO(mp_barrett_mulmod(&a, &e, &ctx, &d));
+      DO(mp_mulmod(&a, &e, &n, &c));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+      DO(mp_barrett_mulmod(&a, &b, &ctx, &d));
+      DO(mp_mulmod(&a, &b, &n, &c));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+      DO(mp_barrett_sqrmod(&e, &ctx, &d));
+      DO(mp_sqrmod(&e, &n, &c));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+      DO(mp_barrett_sqrmod(&b, &ctx, &d));
+      DO(mp_sqrmod(&b, &n, &c));
+      EXPECT(mp_cmp(&d, &c) == MP_EQ);
+
+      mp_barrett_ctx_clear(&ctx);
+      have_ctx = false;
+   }
+
+   mp_clear_multi(&n, &a, &b, &c, &d, &e, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   if (have_ctx) {
+      mp_barrett_ctx_clear(&ctx);
+   }
+   mp_clear_multi(&n, &a, &b, &c, &d, &e, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_div_ctx(void)
+{
+   mp_int n, a, c_q, c_r, d_q, d_r;
+   mp_div_ctx ctx;
+   bool have_ctx = false;
+   int size, i;
+
+   DOR(mp_init_multi(&n, &a, &c_q, &c_r, &d_q, &d_r, NULL));
+
+   /* no division by zero */
+   mp_zero(&n);
+   EXPECT(mp_div_ctx_init(&ctx, &n) == MP_VAL);
+
+   for (size = 1; size < 300; size += 1 + (size / 4)) {
+      DO(mp_rand(&n, size));
+      if ((size % 3) == 0) {
+         DO(mp_neg(&n, &n));
+      }
+      if ((size % 5) == 0) {
+         DO(mp_2expt(&n, size * MP_DIGIT_BIT));
+         DO(mp_decr(&n));
+      }
+      DO(mp_div_ctx_init(&ctx, &n));
+      have_ctx = true;
+
+      /* below the divisor, zero, about its size and far larger, of both signs */
+      for (i = 0; i < 12; i++) {
+         if (i == 0) {
+            mp_zero(&a);
+         } else {
+            DO(mp_rand(&a, ((size * i) / 2) + (i % 3)));
+         }
+         if ((i & 1) == 1) {
+            DO(mp_neg(&a, &a));
+         }
+         DO(mp_div_with_ctx(&a, &ctx, &c_q, &c_r));
+         DO(mp_div(&a, &n, &d_q, &d_r));
+         EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+         EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+
+         /* the quotient over the dividend */
+         DO(mp_copy(&a, &c_q));
+         DO(mp_div_with_ctx(&c_q, &ctx, &c_q, &c_r));
+         EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+         EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      }
+
+      /* either of the results may be left out, a multiple of N */
+      DO(mp_div_with_ctx(&a, &ctx, NULL, &c_r));
+      EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      DO(mp_div_with_ctx(&a, &ctx, &c_q, NULL));
+      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+      DO(mp_mul(&n, &d_q, &a));
+      DO(mp_div_with_ctx(&a, &ctx, &c_q, &c_r));
+      EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+      EXPECT(mp_iszero(&c_r));
+
+      mp_div_ctx_clear(&ctx);
+      have_ctx = false;
+   }
+
+   mp_clear_multi(&n, &a, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   if (have_ctx) {
+      mp_div_ctx_clear(&ctx);
+   }
+   mp_clear_multi(&n, &a, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_divexact(void)
+{
+   mp_int a, b, q, c;
+   int size, i;
+
+   DOR(mp_init_multi(&a, &b, &q, &c, NULL));
+
+   /* no division by zero, zero divided by anything */
+   mp_zero(&b);
+   EXPECT(mp_divexact(&a, &b, &c) == MP_VAL);
+   mp_set(&b, 3uL);
+   DO(mp_divexact(&a, &b, &c));
+   EXPECT(mp_iszero(&c));
+
+   for (size = 1; size < 400; size += 1 + (size / 3)) {
+      for (i = 0; i < 8; i++) {
+         /* divisors of one digit, with factors of two, of 1 and of -1 */
+         if (i == 0) {
+            mp_set(&b, 1uL);
+         } else if (i == 1) {
+            DO(mp_rand(&b, 1));
+         } else {
+            DO(mp_rand(&b, MP_MAX((size * i) / 4, 1)));
+         }
+         if (i == 5) {
+            DO(mp_mul_2d(&b, (size * 7) % 200, &b));
+         }
+         DO(mp_rand(&q, size));
+         if ((i & 1) == 1) {
+            DO(mp_neg(&b, &b));
+         }
+         if ((i & 2) == 2) {
+            DO(mp_neg(&q, &q));
+         }
+         DO(mp_mul(&b, &q, &a));
+         DO(mp_divexact(&a, &b, &c));
+         EXPECT(mp_cmp(&c, &q) == MP_EQ);
+      }
+   }
+
+   /* the quotient may overwrite either of the inputs */
+   DO(mp_divexact(&a, &b, &a));
+   EXPECT(mp_cmp(&a, &q) == MP_EQ);
+   DO(mp_mul(&b, &q, &a));
+   DO(mp_divexact(&a, &b, &b));
+   EXPECT(mp_cmp(&b, &q) == MP_EQ);
+
+   mp_clear_multi(&a, &b, &q, &c, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &q, &c, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_exptmod_batch(void)
+{
+#define BATCH_N 40
+   mp_int g[BATCH_N], x[BATCH_N], p[BATCH_N], y[BATCH_N], z;
+   const mp_int *G[BATCH_N], *X[BATCH_N], *P[BATCH_N];
+   mp_int *Y[BATCH_N];
+   int i, j, threads;
+
+   for (i = 0; i < BATCH_N; i++) {
+      DOR(mp_init_multi(&g[i], &x[i], &p[i], &y[i], NULL));
+      G[i] = &g[i];
+      X[i] = &x[i];
+      P[i] = &p[i];
+      Y[i] = &y[i];
+   }
+   DO(mp_init(&z));
+
+   EXPECT(mp_exptmod_batch(G, X, P, Y, -1, 1) == MP_VAL);
+   EXPECT(mp_exptmod_batch(G, X, P, Y, 1, 0) == MP_VAL);
+   DO(mp_exptmod_batch(G, X, P, Y, 0, 4));
+
+   /* runs of the same modulus, odd, even, 2**k - d and negative exponents */
+   for (i = 0; i < BATCH_N; i++) {
+      if ((i % 7) == 0) {
+         DO(mp_rand(&p[i], 1 + (i % 5) * 3));
+         if ((i % 3) != 1) {
+            p[i].dp[0] |= 1u;
+         }
+         if (i == 14) {
+            DO(mp_2expt(&p[i], 255));
+            DO(mp_sub_d(&p[i], 19u, &p[i]));
+         }
+         if (mp_cmp_d(&p[i], 2u) != MP_GT) {
+            mp_set(&p[i], 101u);
+         }
+      } else {
+         DO(mp_copy(&p[i - 1], &p[i]));
+      }
+      DO(mp_rand(&g[i], p[i].used));
+      DO(mp_rand(&x[i], 1 + (i % 4)));
+      if ((i % 11) == 5) {
+         mp_zero(&x[i]);
+      }
+      if (((i % 9) == 4) && mp_isodd(&p[i])) {
+         /* an invertible base */
+         do {
+            DO(mp_rand(&g[i], p[i].used));
+            DO(mp_gcd(&g[i], &p[i], &z));
+         } while (mp_cmp_d(&z, 1u) != MP_EQ);
+         x[i].sign = MP_NEG;
+      }
+   }
+
+   for (threads = 1; threads <= 9; threads += 4) {
+      for (j = 0; j < BATCH_N; j++) {
+         mp_zero(&y[j]);
+      }
+      DO(mp_exptmod_batch(G, X, P, Y, BATCH_N, threads));
+      for (j = 0; j < BATCH_N; j++) {
+         DO(mp_exptmod(&g[j], &x[j], &p[j], &z));
+         EXPECT(mp_cmp(&y[j], &z) == MP_EQ);
+      }
+   }
+
+   /* the error of a job is returned */
+   mp_zero(&p[BATCH_N - 1]);
+   EXPECT(mp_exptmod_batch(G, X, P, Y, BATCH_N, 2) != MP_OKAY);
+
+   for (i = 0; i < BATCH_N; i++) {
+      mp_clear_multi(&g[i], &x[i], &p[i], &y[i], NULL);
+   }
+   mp_clear(&z);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   for (i = 0; i < BATCH_N; i++) {
+      mp_clear_multi(&g[i], &x[i], &p[i], &y[i], NULL);
+   }
+   mp_clear(&z);
+   return EXIT_FAILURE;
+#undef BATCH_N
+}
+
+static int test_mp_exptmod_ct(void)
+{
+   mp_int g, x, p, y, z;
+   int size, i;
+
+   DOR(mp_init_multi(&g, &x, &p, &y, &z, NULL));
+
+   /* only odd moduli and exponents >= 0 */
+   mp_set(&g, 3u);
+   mp_set(&x, 5u);
+   mp_set(&p, 10u);
+   EXPECT(mp_exptmod_ct(&g, &x, &p, &y) == MP_VAL);
+   mp_set(&p, 11u);
+   x.sign = MP_NEG;
+   EXPECT(mp_exptmod_ct(&g, &x, &p, &y) == MP_VAL);
+   x.sign = MP_ZPOS;
+   mp_set(&p, 1u);
+   DO(mp_exptmod_ct(&g, &x, &p, &y));
+   EXPECT(mp_iszero(&y));
+
+   for (size = 1; size < 80; size += 1 + (size / 4)) {
+      for (i = 0; i < 6; i++) {
+         DO(mp_rand(&p, size));
+         p.dp[0] |= 1u;
+         if (mp_cmp_d(&p, 1u) == MP_EQ) {
+            mp_set(&p, 3u);
+         }
+         /* all bits set, one more digit for R > 4P */
+         if (i == 1) {
+            DO(mp_2expt(&p, size * MP_DIGIT_BIT));
+            DO(mp_decr(&p));
+         }
+         DO(mp_rand(&g, size + (i % 2)));
+         if (i == 2) {
+            g.sign = MP_NEG;
+         }
+         DO(mp_rand(&x, (i * size / 2) + 1));
+         if (i == 3) {
+            mp_zero(&x);
+         } else if (i == 4) {
+            mp_set(&x, 1u);
+         } else if (i == 5) {
+            DO(mp_copy(&p, &g));
+         }
+         DO(mp_exptmod_ct(&g, &x, &p, &y));
+         DO(mp_exptmod(&g, &x, &p, &z));
+         EXPECT(mp_cmp(&y, &z) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_exptmod_crt(void)
+{
+   mp_int p, q, dp, dq, qinv, d, n, c, y, z;
+   int bits, i;
+
+   DOR(mp_init_multi(&p, &q, &dp, &dq, &qinv, &d, &n, &c, &y, &z, NULL));
+
+   mp_zero(&p);
+   mp_set(&q, 3u);
+   EXPECT(mp_exptmod_crt(&c, &p, &q, &dp, &dq, &qinv, false, &y) == MP_VAL);
+
+   for (bits = 64; bits <= 1024; bits *= 2) {
+      /* RSA key with e = 65537 */
+      DO(mp_prime_rand(&p, 8, bits / 2, MP_PRIME_2MSB_ON));
+      do {
+         DO(mp_prime_rand(&q, 8, bits / 2, MP_PRIME_2MSB_ON));
+      } while (mp_cmp(&p, &q) == MP_EQ);
+      DO(mp_mul(&p, &q, &n));
+      DO(mp_decr(&p));
+      DO(mp_decr(&q));
+      DO(mp_lcm(&p, &q, &d));
+      mp_set_u32(&z, 65537u);
+      if (mp_invmod(&z, &d, &d) != MP_OKAY) {
+         DO(mp_incr(&p));
+         DO(mp_incr(&q));
+         continue;
+      }
+      DO(mp_mod(&d, &p, &dp));
+      DO(mp_mod(&d, &q, &dq));
+      DO(mp_incr(&p));
+      DO(mp_incr(&q));
+      DO(mp_invmod(&q, &p, &qinv));
+
+      for (i = 0; i < 4; i++) {
+         DO(mp_rand(&c, n.used));
+         DO(mp_mod(&c, &n, &c));
+         if (i == 1) {
+            mp_zero(&c);
+         } else if (i == 2) {
+            DO(mp_copy(&q, &c));
+         }
+         DO(mp_exptmod(&c, &d, &n, &z));
+         DO(mp_exptmod_crt(&c, &p, &q, &dp, &dq, &qinv, false, &y));
+         EXPECT(mp_cmp(&y, &z) == MP_EQ);
+         /* in place, on two threads */
+         DO(mp_exptmod_crt(&c, &p, &q, &dp, &dq, &qinv, true, &c));
+         EXPECT(mp_cmp(&c, &z) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&p, &q, &dp, &dq, &qinv, &d, &n, &c, &y, &z, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&p, &q, &dp, &dq, &qinv, &d, &n, &c, &y, &z, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_exptmod_d(void)
+{
+   static const uint32_t exps[] = { 0u, 1u, 2u, 3u, 17u, 65537u, 0x80000000u, 0xFFFFFFFFu };
+   mp_int g, p, x, y, z;
+   int i, j, k, b;
+
+   DOR(mp_init_multi(&g, &p, &x, &y, &z, NULL));
+
+   mp_set(&p, 7u);
+   p.sign = MP_NEG;
+   EXPECT(mp_exptmod_d(&g, 3u, &p, &y) == MP_VAL);
+
+   for (i = 0; i < 9; i++) {
+      switch (i) {
+      case 0:
+         /* odd, Montgomery */
+         DO(mp_rand(&p, 20));
+         p.dp[0] |= 1u;
+         break;
+      case 1:
+         /* even, Barrett */
+         DO(mp_rand(&p, 17));
+         p.dp[0] &= ~(mp_digit)1;
+         break;
+      case 2:
+         /* DR */
+         DO(mp_2expt(&p, 8 * MP_DIGIT_BIT));
+         DO(mp_sub_d(&p, 183u, &p));
+         break;
+      case 3:
+         /* 2**k - b */
+         DO(mp_2expt(&p, 333));
+         DO(mp_sub_d(&p, 5u, &p));
+         break;
+      case 4:
+         /* 2**255 - 19 */
+         DO(mp_2expt(&p, 255));
+         DO(mp_sub_d(&p, 19u, &p));
+         break;
+      case 5:
+         mp_set(&p, 1u);
+         break;
+      case 6:
+         mp_set(&p, 2u);
+         break;
+      case 7:
+         DO(mp_rand(&p, 1));
+         p.dp[0] |= 1u;
+         break;
+      default:
+         DO(mp_rand(&p, 3));
+         break;
+      }
+      for (j = 0; j < 12; j++) {
+         DO(mp_rand(&g, p.used + (j % 3)));
+         if ((j % 4) == 1) {
+            g.sign = MP_NEG;
+         }
+         for (k = 0; k < (int)(sizeof(exps) / sizeof(exps[0])) + 4; k++) {
+            uint32_t e = (k < (int)(sizeof(exps) / sizeof(exps[0]))) ? exps[k] : (uint32_t)rand_long();
+
+            /* square and multiply with mp_mulmod */
+            mp_set(&y, 1u);
+            DO(mp_mod(&y, &p, &y));
+            for (b = 31; b >= 0; b--) {
+               DO(mp_mulmod(&y, &y, &p, &y));
+               if (((e >> b) & 1u) != 0u) {
+                  DO(mp_mulmod(&y, &g, &p, &y));
+               }
+            }
+            DO(mp_exptmod_d(&g, e, &p, &z));
+            EXPECT(mp_cmp(&y, &z) == MP_EQ);
+
+            /* mp_exptmod takes it for short exponents */
+            mp_set_u32(&x, e);
+            DO(mp_exptmod(&g, &x, &p, &z));
+            EXPECT(mp_cmp(&y, &z) == MP_EQ);
+         }
+      }
+   }
+
+   mp_clear_multi(&g, &p, &x, &y, &z, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&g, &p, &x, &y, &z, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_exptmod_multi(void)
+{
+   mp_int g[3], x[3], p, y, z, t;
+   const mp_int *G[3], *X[3];
+   int i, kind, size;
+
+   DOR(mp_init_multi(&g[0], &g[1], &g[2], &x[0], &x[1], &x[2], &p, &y, &z, &t, NULL));
+   for (i = 0; i < 3; i++) {
+      G[i] = &g[i];
+      X[i] = &x[i];
+   }
+
+   EXPECT(mp_exptmod_multi(G, X, -1, &p, &y) == MP_VAL);
+
+   for (size = 1; size < 40; size += 1 + (size / 3)) {
+      /* odd, even, DR, 2**k - b and prime moduli */
+      for (kind = 0; kind < 5; kind++) {
+         DO(mp_rand(&p, size));
+         if (kind == 0) {
+            p.dp[0] |= 1u;
+         } else if (kind == 1) {
+            p.dp[0] &= ~(mp_digit)1;
+            if (mp_iszero(&p)) {
+               mp_set(&p, 2u);
+            }
+         } else if (kind == 2) {
+            DO(mp_2expt(&p, size * MP_DIGIT_BIT));
+            DO(mp_sub_d(&p, 159u, &p));
+         } else if (kind == 3) {
+            DO(mp_2expt(&p, (size * MP_DIGIT_BIT) - 3));
+            DO(mp_sub_d(&p, 5u, &p));
+         } else {
+            DO(mp_prime_rand(&p, 8, MP_MIN(size * MP_DIGIT_BIT, 300), 0));
+         }
+
+         for (i = 0; i < 3; i++) {
+            DO(mp_rand(&g[i], size + i));
+            DO(mp_rand(&x[i], (size / (i + 1)) + 1));
+         }
+         mp_zero(&x[2]);
+         g[1].sign = MP_NEG;
+
+         /* exponents can be negative for an invertible base */
+         if (kind == 4) {
+            x[1].sign = MP_NEG;
+         }
+
+         for (i = 0; i <= 3; i++) {
+            DO(mp_exptmod_multi(G, X, i, &p, &y));
+            mp_set(&z, 1u);
+            DO(mp_mod(&z, &p, &z));
+            if (i > 0) {
+               DO(mp_exptmod(G[0], X[0], &p, &t));
+               DO(mp_mulmod(&z, &t, &p, &z));
+            }
+            if (i > 1) {
+               DO(mp_exptmod(G[1], X[1], &p, &t));
+               DO(mp_mulmod(&z, &t, &p, &z));
+            }
+            if (i > 2) {
+               DO(mp_exptmod(G[2], X[2], &p, &t));
+               DO(mp_mulmod(&z, &t, &p, &z));
+            }
+            EXPECT(mp_cmp(&y, &z) == MP_EQ);
+         }
+      }
+   }
+
+   mp_clear_multi(&g[0], &g[1], &g[2], &x[0], &x[1], &x[2], &p, &y, &z, &t, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&g[0], &g[1], &g[2], &x[0], &x[1], &x[2], &p, &y, &z, &t, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_fixed_base(void)
+{
+   /* 2 mod 1000003 with teeth 2 and spacing 4, the entries are 1, 2, 2**16 and 2**17,
+    * it has to read back the same for every MP_DIGIT_BIT
+    */
+   static const uint8_t blob[27] = {
+      0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03,
+      0x0f, 0x42, 0x43,
+      0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00
+   };
+   uint8_t blob2[sizeof(blob)];
+   mp_int g, x, p, y, z;
+   mp_fixed_base fb, fb2;
+   uint8_t *buf = NULL;
+   size_t size = 0, written;
+   bool have_fb = false, have_fb2 = false;
+   int bits, i;
+
+   DOR(mp_init_multi(&g, &x, &p, &y, &z, NULL));
+
+   DO(mp_fixed_base_from_bin(&fb2, blob, sizeof(blob)));
+   have_fb2 = true;
+   mp_set(&g, 2u);
+   mp_set_u32(&p, 1000003u);
+   for (i = 0; i < 256; i++) {
+      mp_set(&x, (mp_digit)i);
+      DO(mp_fixed_base_exptmod(&fb2, &x, &y));
+      DO(mp_exptmod(&g, &x, &p, &z));
+      EXPECT(mp_cmp(&y, &z) == MP_EQ);
+   }
+   DO(mp_fixed_base_to_bin(&fb2, blob2, sizeof(blob2), &written));
+   EXPECT(written == sizeof(blob));
+   EXPECT(memcmp(blob, blob2, sizeof(blob)) == 0);
+   mp_fixed_base_clear(&fb2);
+   have_fb2 = false;
+
+   /* no more teeth than mp_fixed_base_init uses, here with P = 3 and entries 0 */
+   for (bits = MP_FIXED_BASE_MAX_TEETH; bits <= (MP_FIXED_BASE_MAX_TEETH + 1); bits++) {
+      size = 12u + ((size_t)1 << bits) + 1u;
+      buf = (uint8_t *)calloc(size, 1u);
+      EXPECT(buf != NULL);
+      buf[3] = (uint8_t)bits;
+      buf[7] = 1u;
+      buf[11] = 1u;
+      buf[12] = 3u;
+      if (bits == MP_FIXED_BASE_MAX_TEETH) {
+         DO(mp_fixed_base_from_bin(&fb2, buf, size));
+         mp_fixed_base_clear(&fb2);
+      } else {
+         EXPECT(mp_fixed_base_from_bin(&fb2, buf, size) == MP_VAL);
+      }
+      free(buf);
+      buf = NULL;
+   }
+
+   /* only odd moduli > 1 and at least one bit */
+   mp_set(&g, 3u);
+   mp_set(&p, 10u);
+   EXPECT(mp_fixed_base_init(&fb, &g, &p, 64) == MP_VAL);
+   mp_set(&p, 11u);
+   EXPECT(mp_fixed_base_init(&fb, &g, &p, 0) == MP_VAL);
+
+   for (bits = 8; bits < 2200; bits += 1 + (bits / 2)) {
+      DO(mp_prime_rand(&p, 8, MP_MAX(bits, 16), 0));
+      DO(mp_rand(&g, p.used + 1));
+      DO(mp_fixed_base_init(&fb, &g, &p, bits));
+      have_fb = true;
+
+      for (i = 0; i < 8; i++) {
+         DO(mp_rand(&x, (bits + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT));
+         if (i < 4) {
+            /* up to the size of the table */
+            DO(mp_mod_2d(&x, bits - (bits * i / 4), &x));
+         } else if (i == 4) {
+            mp_zero(&x);
+         } else if (i == 5) {
+            mp_set(&x, 1u);
+         } else if (i == 6) {
+            /* larger than the table */
+            DO(mp_mul_2d(&x, 8 * MP_DIGIT_BIT, &x));
+            DO(mp_add_d(&x, 1u, &x));
+         } else {
+            x.sign = MP_NEG;
+         }
+         DO(mp_fixed_base_exptmod(&fb, &x, &y));
+         DO(mp_exptmod(&g, &x, &p, &z));
+         EXPECT(mp_cmp(&y, &z) == MP_EQ);
+      }
+
+      /* a table read back gives the same results */
+      size = mp_fixed_base_bin_size(&fb);
+      buf = (uint8_t *)malloc(size);
+      EXPECT(buf != NULL);
+      EXPECT(mp_fixed_base_to_bin(&fb, buf, size - 1u, &written) == MP_BUF);
+      DO(mp_fixed_base_to_bin(&fb, buf, size, &written));
+      EXPECT(written == size);
+      EXPECT(mp_fixed_base_from_bin(&fb2, buf, size - 1u) == MP_VAL);
+      DO(mp_fixed_base_from_bin(&fb2, buf, size));
+      have_fb2 = true;
+      EXPECT(mp_fixed_base_bin_size(&fb2) == size);
+      DO(mp_rand(&x, (bits + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT));
+      DO(mp_mod_2d(&x, bits, &x));
+      DO(mp_fixed_base_exptmod(&fb2, &x, &y));
+      DO(mp_exptmod(&g, &x, &p, &z));
+      EXPECT(mp_cmp(&y, &z) == MP_EQ);
+
+      mp_fixed_base_clear(&fb2);
+      have_fb2 = false;
+
+      /* entries must be reduced */
+      for (written = 12u; written < (size - 1u); written++) {
+         buf[written] = 255u;
+      }
+      EXPECT(mp_fixed_base_from_bin(&fb2, buf, size) == MP_VAL);
+
+      free(buf);
+      buf = NULL;
+      mp_fixed_base_clear(&fb);
+      have_fb = false;
+   }
+
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   free(buf);
+   if (have_fb2) {
+      mp_fixed_base_clear(&fb2);
+   }
+   if (have_fb) {
+      mp_fixed_base_clear(&fb);
+   }
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_FAILURE;
+}
+
 static int test_mp_read_radix(void)
 {
    char buf[4096];
@@ -1139,6 +1979,116 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+static int test_mp_div_d(void)
+{
+   mp_int a, b, c, d, e;
+   mp_digit_recip r;
+   mp_digit b_d, r_d;
+   int cnt, i;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, &e, NULL));
+
+   /* the reciprocals of the small primes are the ones s_mp_digit_recip computes */
+   for (i = 0; i < MP_PRIME_TAB_SIZE; i++) {
+      s_mp_digit_recip(s_mp_prime_tab[i], &r);
+      EXPECT(r.d == s_mp_prime_recip_tab[i].d);
+      EXPECT(r.v == s_mp_prime_recip_tab[i].v);
+      EXPECT(r.shift == s_mp_prime_recip_tab[i].shift);
+      EXPECT(r.b1 == s_mp_prime_recip_tab[i].b1);
+      EXPECT(r.b2 == s_mp_prime_recip_tab[i].b2);
+      EXPECT(r.b3 == s_mp_prime_recip_tab[i].b3);
+   }
+
+   EXPECT(mp_div_d(&a, 0u, &c, &r_d) == MP_VAL);
+
+   for (cnt = 0; cnt < 4000; cnt++) {
+      /* divisors of all bit sizes and the largest ones of a size */
+      i = cnt % MP_DIGIT_BIT;
+      if ((cnt % 5) == 0) {
+         b_d = ((mp_digit)1 << i) + 1u;
+      } else if ((cnt % 5) == 1) {
+         b_d = MP_MASK >> i;
+      } else {
+         DO(mp_rand(&b, 1));
+         b_d = (b.dp[0] >> i) | 1u;
+      }
+      DO(mp_rand(&a, (cnt % 40) + 1));
+      if ((cnt & 1) == 1) {
+         DO(mp_neg(&a, &a));
+      }
+      mp_set(&b, b_d);
+      DO(mp_div(&a, &b, &d, &e));
+      DO(mp_div_d(&a, b_d, &c, &r_d));
+      /* the remainder is the one of |a| */
+      DO(mp_abs(&e, &e));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+      EXPECT(mp_cmp_d(&e, r_d) == MP_EQ);
+      DO(mp_mod_d(&a, b_d, &r_d));
+      EXPECT(mp_cmp_d(&e, r_d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, &e, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, &e, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_mp_mod_d_multi(void)
+{
+#define MOD_D_MULTI_N 300
+   mp_int a, b;
+   mp_digit d[MOD_D_MULTI_N], c[MOD_D_MULTI_N], r;
+   int cnt, i, n;
+
+   DOR(mp_init_multi(&a, &b, NULL));
+
+   /* no division by zero, even if it is not the first one */
+   d[0] = 3u;
+   d[1] = 0u;
+   EXPECT(mp_mod_d_multi(&a, d, 2, c) == MP_VAL);
+
+   for (cnt = 0; cnt < 400; cnt++) {
+      /* many small divisors, large ones in between, powers of two and 1 */
+      n = ((cnt * 7) % MOD_D_MULTI_N) + 1;
+      for (i = 0; i < n; i++) {
+         DO(mp_rand(&b, 1));
+         if ((i % 17) == 5) {
+            d[i] = b.dp[0] | 1u;
+         } else if ((i % 29) == 3) {
+            d[i] = (mp_digit)1 << (i % MP_DIGIT_BIT);
+         } else if ((i % 31) == 7) {
+            d[i] = MP_MASK >> 2;
+         } else {
+            d[i] = (b.dp[0] >> (MP_DIGIT_BIT - 1 - ((i + cnt) % 12))) | 1u;
+         }
+      }
+      if ((cnt % 10) == 0) {
+         mp_zero(&a);
+      } else {
+         DO(mp_rand(&a, (cnt % 50) + 1));
+      }
+      DO(mp_mod_d_multi(&a, d, n, c));
+      for (i = 0; i < n; i++) {
+         DO(mp_mod_d(&a, d[i], &r));
+         EXPECT(c[i] == r);
+      }
+
+      /* the remainders may overwrite the divisors */
+      DO(mp_mod_d_multi(&a, d, n, d));
+      for (i = 0; i < n; i++) {
+         EXPECT(c[i] == d[i]);
+      }
+   }
+
+   mp_clear_multi(&a, &b, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, NULL);
+   return EXIT_FAILURE;
+#undef MOD_D_MULTI_N
+}
+
 static int test_mp_dr_reduce(void)
 {
    mp_digit mp;
@@ -1251,6 +2201,83 @@ LBL_ERR:
    return EXIT_SUCCESS;
 #   endif /* LTM_DEMO_TEST_REDUCE_2K_L */
 }
+
+static int test_mp_reduce_special(void)
+{
+   static const char *primes[] = {
+      "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF",
+      "1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF",
+      "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F"
+   };
+   mp_int p, a, b, c, x, y;
+   mp_digit d;
+   int i, n;
+
+   DOR(mp_init_multi(&p, &a, &b, &c, &x, &y, NULL));
+
+   for (i = 0; i < (int)(sizeof(primes) / sizeof(primes[0])); i++) {
+      DO(mp_read_radix(&p, primes[i], 16));
+      EXPECT(mp_reduce_is_special(&p));
+
+      /* the neighbours are not */
+      DO(mp_add_d(&p, 2u, &a));
+      EXPECT(!mp_reduce_is_special(&a));
+      EXPECT(mp_reduce_special_setup(&a, &d) == MP_VAL);
+      DO(mp_reduce_special_setup(&p, &d));
+
+      for (n = 0; n < 2000; n++) {
+         if (n == 0) {
+            /* (p - 1)**2, the largest product of two reduced values */
+            DO(mp_sub_d(&p, 1u, &a));
+            DO(mp_sqr(&a, &a));
+         } else if (n == 1) {
+            /* 2**(2*bits) - 1, the largest value of the fast path */
+            DO(mp_2expt(&a, 2 * mp_count_bits(&p)));
+            DO(mp_decr(&a));
+         } else if (n == 2) {
+            DO(mp_copy(&p, &a));
+         } else if (n == 3) {
+            mp_zero(&a);
+         } else if (n == 4) {
+            /* beyond the fast path and negative */
+            DO(mp_rand(&a, 4 * p.used));
+            a.sign = MP_NEG;
+         } else {
+            DO(mp_rand(&a, 1 + (n % (2 * p.used))));
+         }
+         DO(mp_mod(&a, &p, &b));
+         DO(mp_reduce_special(&a, &p, d));
+         EXPECT(mp_cmp(&a, &b) == MP_EQ);
+      }
+
+      /* mp_mulmod, mp_sqrmod and mp_exptmod take the reduction */
+      for (n = 0; n < 20; n++) {
+         DO(mp_rand(&a, p.used));
+         DO(mp_rand(&b, p.used));
+         DO(mp_mod(&a, &p, &a));
+         DO(mp_mul(&a, &b, &c));
+         DO(mp_mod(&c, &p, &c));
+         DO(mp_mulmod(&a, &b, &p, &x));
+         EXPECT(mp_cmp(&x, &c) == MP_EQ);
+         DO(mp_sqr(&a, &c));
+         DO(mp_mod(&c, &p, &c));
+         DO(mp_sqrmod(&a, &p, &x));
+         EXPECT(mp_cmp(&x, &c) == MP_EQ);
+         DO(mp_exptmod(&a, &b, &p, &x));
+         DO(mp_exptmod_ct(&a, &b, &p, &y));
+         EXPECT(mp_cmp(&x, &y) == MP_EQ);
+      }
+   }
+
+   mp_clear_multi(&p, &a, &b, &c, &x, &y, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&p, &a, &b, &c, &x, &y, NULL);
+   return EXIT_FAILURE;
+}
+
 /* stripped down version of mp_radix_size. The faster version can be off by up t
 o +3  */
 static mp_err s_rs(const mp_int *a, int radix, int *size)
@@ -1818,6 +2845,398 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+static int test_s_mp_mul_toom32(void)
+{
+   mp_int a, b, c, d;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = 2; size < 300; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, size + (size / 2) + (rand_int() % (size / 2 + 1))));
+      DO(mp_rand(&b, size));
+      if ((size & 1) != 0) {
+         DO(mp_neg(&a, &a));
+      }
+      DO(s_mp_mul_toom32(&a, &b, &c));
+      DO(s_mp_mul_full(&a,&b,&d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+      DO(s_mp_mul_toom32(&b, &a, &c));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mul_toom43(void)
+{
+   mp_int a, b, c, d;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = 3; size < 300; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, size + (size / 4) + (rand_int() % (size / 4 + 1))));
+      DO(mp_rand(&b, size));
+      if ((size & 1) != 0) {
+         DO(mp_neg(&b, &b));
+      }
+      DO(s_mp_mul_toom43(&a, &b, &c));
+      DO(s_mp_mul_full(&a,&b,&d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+      DO(s_mp_mul_toom43(&b, &a, &c));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mul_toom4(void)
+{
+   mp_int a, b, c, d;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = 4; size < 200; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size + (rand_int() & 15)));
+      if ((size & 1) != 0) {
+         DO(mp_neg(&b, &b));
+      }
+      DO(s_mp_mul_toom4(&a, &b, &c));
+      DO(s_mp_mul_full(&a,&b,&d));
+      EXPECT(mp_cmp_mag(&c, &d) == MP_EQ);
+   }
+
+   for (size = MP_MUL_TOOM4_CUTOFF; size < (MP_MUL_TOOM4_CUTOFF + 20); size++) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size));
+      DO(s_mp_mul_toom4(&a, &b, &c));
+      DO(s_mp_mul_full(&a,&b,&d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_sqr_toom4(void)
+{
+   mp_int a, b, c;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, NULL));
+   for (size = 4; size < 200; size += 1 + (size / 8)) {
+      DO(mp_rand(&a, size));
+      DO(s_mp_sqr_toom4(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+   }
+
+   for (size = MP_SQR_TOOM4_CUTOFF; size < (MP_SQR_TOOM4_CUTOFF + 20); size++) {
+      DO(mp_rand(&a, size));
+      DO(s_mp_sqr_toom4(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_exptmod_even(void)
+{
+   static const int ks[] = { 1, 2, 3, 5, 64, 100, 333, 1000, 2500 };
+   mp_int g, x, p, y, z;
+   int i, j, l;
+
+   DOR(mp_init_multi(&g, &x, &p, &y, &z, NULL));
+
+   for (i = 0; i < (int)(sizeof(ks) / sizeof(ks[0])); i++) {
+      for (j = 0; j < 4; j++) {
+         /* 2**k, then times odd m of a few sizes */
+         DO(mp_2expt(&p, ks[i]));
+         if (j > 0) {
+            DO(mp_rand(&z, (j == 3) ? 20 : j));
+            z.dp[0] |= 1u;
+            DO(mp_mul(&p, &z, &p));
+         }
+         if ((ks[i] > 1000) && (j > 1)) {
+            continue;
+         }
+         for (l = 0; l < 8; l++) {
+            DO(mp_rand(&g, p.used));
+            if ((l % 4) == 1) {
+               /* even, the powers vanish modulo 2**k */
+               DO(mp_mul_2d(&g, 1 + (l % 3), &g));
+            }
+            DO(mp_mod(&g, &p, &g));
+            switch (l) {
+            case 0:
+               mp_zero(&x);
+               break;
+            case 1:
+            case 2:
+               /* around k for even g */
+               mp_set_u32(&x, (uint32_t)((ks[i] / (1 + (l % 3))) + l));
+               break;
+            default:
+               DO(mp_rand(&x, 1 + (l % 3)));
+               break;
+            }
+            DO(s_mp_exptmod_even(&g, &x, &p, &y));
+            DO(s_mp_exptmod(&g, &x, &p, &z, 0));
+            EXPECT(mp_cmp(&y, &z) == MP_EQ);
+            DO(mp_exptmod(&g, &x, &p, &y));
+            EXPECT(mp_cmp(&y, &z) == MP_EQ);
+         }
+      }
+   }
+
+   /* G is reduced first */
+   DO(mp_rand(&p, 4));
+   p.dp[0] &= ~(mp_digit)3;
+   DO(mp_rand(&g, 6));
+   g.sign = MP_NEG;
+   DO(mp_rand(&x, 2));
+   DO(s_mp_exptmod_even(&g, &x, &p, &y));
+   DO(mp_mod(&g, &p, &g));
+   DO(s_mp_exptmod(&g, &x, &p, &z, 0));
+   EXPECT(mp_cmp(&y, &z) == MP_EQ);
+
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_FAILURE;
+}
+
+#if defined(S_MP_EXPTMOD_IFMA_C)
+static int test_s_mp_exptmod_ifma(void)
+{
+   mp_int g, x, p, y, z;
+   int bits;
+
+   /* the kernel is always compiled in, the CPU might not support it */
+   if ((mp_cpu_features() & MP_CPU_AVX512IFMA) == 0u) {
+      return EXIT_SUCCESS;
+   }
+
+   DOR(mp_init_multi(&g, &x, &p, &y, &z, NULL));
+   for (bits = 64; bits <= 4200; bits += 1 + (bits / 3)) {
+      DO(mp_rand(&p, (bits + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT));
+      DO(mp_mod_2d(&p, bits - 1, &p));
+      DO(mp_2expt(&z, bits - 1));
+      DO(mp_add(&p, &z, &p));
+      p.dp[0] |= 1u;
+      DO(mp_rand(&g, p.used + 1));
+      DO(mp_rand(&x, p.used));
+      DO(s_mp_exptmod_ifma(&g, &x, &p, &y));
+      DO(s_mp_exptmod(&g, &x, &p, &z, 0));
+      EXPECT(mp_cmp(&y, &z) == MP_EQ);
+
+      /* all bits of the modulus set */
+      DO(mp_2expt(&p, bits));
+      DO(mp_decr(&p));
+      DO(mp_sub_d(&p, 1u, &g));
+      DO(s_mp_exptmod_ifma(&g, &x, &p, &y));
+      DO(s_mp_exptmod(&g, &x, &p, &z, 0));
+      EXPECT(mp_cmp(&y, &z) == MP_EQ);
+
+      /* trivial exponents */
+      mp_zero(&x);
+      DO(s_mp_exptmod_ifma(&g, &x, &p, &y));
+      EXPECT(mp_cmp_d(&y, 1u) == MP_EQ);
+      mp_set(&x, 1u);
+      DO(s_mp_exptmod_ifma(&g, &x, &p, &y));
+      EXPECT(mp_cmp(&y, &g) == MP_EQ);
+   }
+
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&g, &x, &p, &y, &z, NULL);
+   return EXIT_FAILURE;
+}
+#endif
+
+#if defined(S_MP_EXPTMOD4_AVX2_C)
+static int test_s_mp_exptmod4_avx2(void)
+{
+   mp_int g[4], x[4], p[4], y[4], z;
+   const mp_int *G[4], *X[4], *P[4];
+   mp_int *Y[4];
+   int bits, k;
+
+   /* the kernel is always compiled in, the CPU might not support it */
+   if ((mp_cpu_features() & MP_CPU_AVX2) == 0u) {
+      return EXIT_SUCCESS;
+   }
+
+   for (k = 0; k < 4; k++) {
+      DOR(mp_init_multi(&g[k], &x[k], &p[k], &y[k], NULL));
+      G[k] = &g[k];
+      X[k] = &x[k];
+      P[k] = &p[k];
+      Y[k] = &y[k];
+   }
+   DO(mp_init(&z));
+
+   for (bits = 8; bits <= MP_AVX2_MAX_BITS; bits += 1 + (bits / 3)) {
+      for (k = 0; k < 4; k++) {
+         /* different sizes of moduli and exponents */
+         DO(mp_rand(&p[k], (bits + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT));
+         DO(mp_mod_2d(&p[k], bits - (k * bits / 8), &p[k]));
+         p[k].dp[0] |= 1u;
+         if (mp_cmp_d(&p[k], 1u) == MP_EQ) {
+            mp_set(&p[k], 3u);
+         }
+         DO(mp_rand(&g[k], p[k].used + 1));
+         DO(mp_rand(&x[k], MP_MAX(p[k].used - (k / 2), 1)));
+      }
+      /* all bits of the modulus set, a trivial exponent and a base of P - 1 */
+      DO(mp_2expt(&p[1], bits));
+      DO(mp_decr(&p[1]));
+      mp_zero(&x[2]);
+      DO(mp_sub_d(&p[3], 1u, &g[3]));
+
+      DO(s_mp_exptmod4_avx2(G, X, P, Y));
+      for (k = 0; k < 4; k++) {
+         DO(s_mp_exptmod(&g[k], &x[k], &p[k], &z, 0));
+         EXPECT(mp_cmp(&y[k], &z) == MP_EQ);
+      }
+
+      /* in place */
+      G[0] = &y[0];
+      Y[0] = &y[0];
+      DO(mp_copy(&g[0], &y[0]));
+      DO(s_mp_exptmod4_avx2(G, X, P, Y));
+      DO(s_mp_exptmod(&g[0], &x[0], &p[0], &z, 0));
+      EXPECT(mp_cmp(&y[0], &z) == MP_EQ);
+      G[0] = &g[0];
+   }
+
+   /* only odd moduli up to MP_AVX2_MAX_BITS and exponents >= 0 */
+   DO(mp_2expt(&p[0], MP_AVX2_MAX_BITS));
+   DO(mp_incr(&p[0]));
+   EXPECT(s_mp_exptmod4_avx2(G, X, P, Y) == MP_VAL);
+   mp_set(&p[0], 4u);
+   EXPECT(s_mp_exptmod4_avx2(G, X, P, Y) == MP_VAL);
+   mp_set(&p[0], 5u);
+   x[3].sign = MP_NEG;
+   EXPECT(s_mp_exptmod4_avx2(G, X, P, Y) == MP_VAL);
+
+   for (k = 0; k < 4; k++) {
+      mp_clear_multi(&g[k], &x[k], &p[k], &y[k], NULL);
+   }
+   mp_clear(&z);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   for (k = 0; k < 4; k++) {
+      mp_clear_multi(&g[k], &x[k], &p[k], &y[k], NULL);
+   }
+   mp_clear(&z);
+   return EXIT_FAILURE;
+}
+#endif
+
+static int test_mp_kernel_name(void)
+{
+   unsigned int features = mp_cpu_features();
+   int k;
+
+   for (k = (int)MP_KERNEL_EXPTMOD; k <= (int)MP_KERNEL_EXPTMOD4; k++) {
+      EXPECT(mp_kernel_name((mp_kernel)k) != NULL);
+   }
+   EXPECT(mp_kernel_name((mp_kernel)(MP_KERNEL_EXPTMOD4 + 1)) == NULL);
+
+   /* a kernel is only chosen if the CPU has what it needs */
+   if (strcmp(mp_kernel_name(MP_KERNEL_EXPTMOD), "avx512ifma") == 0) {
+      EXPECT((features & MP_CPU_AVX512F) != 0u);
+      EXPECT((features & MP_CPU_AVX512IFMA) != 0u);
+   } else {
+      EXPECT(!MP_HAS(S_MP_EXPTMOD_IFMA) || ((features & MP_CPU_AVX512IFMA) == 0u));
+   }
+   if (strcmp(mp_kernel_name(MP_KERNEL_EXPTMOD4), "avx2") == 0) {
+      EXPECT((features & MP_CPU_AVX2) != 0u);
+   } else {
+      EXPECT(!MP_HAS(S_MP_EXPTMOD4_AVX2) || ((features & MP_CPU_AVX2) == 0u));
+   }
+   EXPECT(((features & MP_CPU_AVX512IFMA) == 0u) || ((features & MP_CPU_AVX512F) != 0u));
+
+   return EXIT_SUCCESS;
+LBL_ERR:
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_mul_fft(void)
+{
+   mp_int a, b, c, d;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, &d, NULL));
+   for (size = 1; size < 300; size += 1 + (size / 4)) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size + (rand_int() & 63)));
+      DO(s_mp_mul_fft(&a, &b, &c));
+      DO(s_mp_mul_full(&a,&b,&d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
+   /* all coefficients at their maximum */
+   DO(mp_2expt(&a, 2000 * MP_DIGIT_BIT));
+   DO(mp_decr(&a));
+   DO(s_mp_mul_fft(&a, &a, &c));
+   DO(s_mp_mul_full(&a,&a,&d));
+   EXPECT(mp_cmp(&c, &d) == MP_EQ);
+
+   for (size = MP_MUL_FFT_CUTOFF; size < (MP_MUL_FFT_CUTOFF + 3); size++) {
+      DO(mp_rand(&a, size));
+      DO(mp_rand(&b, size));
+      DO(s_mp_mul_fft(&a, &b, &c));
+      DO(s_mp_mul_full(&a,&b,&d));
+      EXPECT(mp_cmp(&c, &d) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_sqr_fft(void)
+{
+   mp_int a, b, c;
+   int size;
+
+   DOR(mp_init_multi(&a, &b, &c, NULL));
+   for (size = MP_SQR_FFT_CUTOFF; size < (MP_SQR_FFT_CUTOFF + 3); size++) {
+      DO(mp_rand(&a, size));
+      DO(s_mp_sqr_fft(&a, &b));
+      DO(s_mp_sqr(&a, &c));
+      EXPECT(mp_cmp(&b, &c) == MP_EQ);
+   }
+
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, NULL);
+   return EXIT_FAILURE;
+}
+
 
 static int test_mp_radix_size(void)
 {
@@ -1924,6 +3343,114 @@ LBL_ERR:
    return EXIT_FAILURE;
 }
 
+/* Short and long quotients, signs and divisors close to powers of the digit base */
+static int test_s_mp_div_newton(void)
+{
+   mp_int a, b, c_q, c_r, d_q, d_r;
+   int size, i, cutoff = MP_DIV_NEWTON_CUTOFF;
+
+   DOR(mp_init_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL));
+
+   /* a few steps of the iteration before the reciprocal gets divided */
+   MP_DIV_NEWTON_CUTOFF = 8;
+   for (size = 1; size < 200; size += 13) {
+      for (i = 0; i < 8; i++) {
+         printf("\rsizes = %d / %d", (2 + i) * size, size);
+         DO(mp_rand(&a, (2 + i) * size));
+         if (i == 3) {
+            DO(mp_2expt(&b, size * MP_DIGIT_BIT));
+            DO(mp_decr(&b));
+         } else if (i == 4) {
+            DO(mp_2expt(&b, (size - 1) * MP_DIGIT_BIT));
+         } else {
+            DO(mp_rand(&b, size));
+         }
+         if ((i & 1) == 1) {
+            DO(mp_neg(&a, &a));
+         }
+         if ((i & 2) == 2) {
+            DO(mp_neg(&b, &b));
+         }
+         DO(s_mp_div_newton(&a, &b, NULL, &c_q, &c_r));
+         DO(s_mp_div_school(&a, &b, &d_q, &d_r));
+         EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+         EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+
+         /* the quotient over the dividend */
+         DO(mp_copy(&a, &c_q));
+         DO(s_mp_div_newton(&c_q, &b, NULL, &c_q, &c_r));
+         EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+         EXPECT(mp_cmp(&c_r, &d_r) == MP_EQ);
+      }
+   }
+
+   /* a remainder of zero and a dividend below the divisor */
+   DO(mp_rand(&b, 100));
+   DO(mp_rand(&c_q, 350));
+   DO(mp_mul(&b, &c_q, &a));
+   DO(s_mp_div_newton(&a, &b, NULL, &d_q, &d_r));
+   EXPECT(mp_cmp(&c_q, &d_q) == MP_EQ);
+   EXPECT(mp_iszero(&d_r));
+   DO(mp_div_2d(&b, 1, &a, NULL));
+   DO(s_mp_div_newton(&a, &b, NULL, &d_q, &d_r));
+   EXPECT(mp_iszero(&d_q));
+   EXPECT(mp_cmp(&a, &d_r) == MP_EQ);
+
+   MP_DIV_NEWTON_CUTOFF = cutoff;
+   mp_clear_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   MP_DIV_NEWTON_CUTOFF = cutoff;
+   mp_clear_multi(&a, &b, &c_q, &c_r, &d_q, &d_r, NULL);
+   return EXIT_FAILURE;
+}
+
+static int test_s_mp_divexact(void)
+{
+   mp_int a, b, q, c_q, d_q;
+   int size, i;
+
+   DOR(mp_init_multi(&a, &b, &q, &c_q, &d_q, NULL));
+
+   /* odd divisors of all sizes against quotients of all sizes */
+   for (size = 1; size < 300; size += 1 + (size / 4)) {
+      for (i = 0; i < 6; i++) {
+         printf("\rsizes = %d / %d", size, ((size * (i + 1)) / 3) + 1);
+         if (i == 3) {
+            DO(mp_2expt(&b, size * MP_DIGIT_BIT));
+            DO(mp_decr(&b));
+         } else {
+            DO(mp_rand(&b, size));
+            DO(mp_abs(&b, &b));
+            b.dp[0] |= 1u;
+         }
+         DO(mp_rand(&q, ((size * (i + 1)) / 3) + 1));
+         DO(mp_abs(&q, &q));
+         if (i == 4) {
+            DO(mp_2expt(&q, size * MP_DIGIT_BIT));
+            DO(mp_decr(&q));
+         }
+         DO(mp_mul(&b, &q, &a));
+         DO(s_mp_divexact_hensel(&a, &b, &c_q));
+         DO(s_mp_divexact_school(&a, &b, &d_q));
+         EXPECT(mp_cmp(&c_q, &q) == MP_EQ);
+         EXPECT(mp_cmp(&d_q, &q) == MP_EQ);
+      }
+   }
+
+   /* a zero dividend */
+   mp_zero(&a);
+   DO(s_mp_divexact_hensel(&a, &b, &c_q));
+   DO(s_mp_divexact_school(&a, &b, &d_q));
+   EXPECT(mp_iszero(&c_q) && mp_iszero(&d_q));
+
+   mp_clear_multi(&a, &b, &q, &c_q, &d_q, NULL);
+   return EXIT_SUCCESS;
+LBL_ERR:
+   mp_clear_multi(&a, &b, &q, &c_q, &d_q, NULL);
+   return EXIT_FAILURE;
+}
+
 static int test_s_mp_div_small(void)
 {
    mp_int a, b, c_q, c_r, d_q, d_r;
@@ -2144,6 +3671,8 @@ static int unit_tests(int argc, char **argv)
       T1(mp_complement, MP_COMPLEMENT),
       T1(mp_decr, MP_SUB_D),
       T1(s_mp_div_3, S_MP_DIV_3),
+      T1(mp_div_d, MP_DIV_D),
+      T1(mp_mod_d_multi, MP_MOD_D_MULTI),
       T1(mp_dr_reduce, MP_DR_REDUCE),
       T2(mp_pack_unpack,MP_PACK, MP_UNPACK),
       T2(mp_fread_fwrite, MP_FREAD, MP_FWRITE),
@@ -2155,7 +3684,18 @@ static int unit_tests(int argc, char **argv)
       T1(mp_invmod, MP_INVMOD),
       T1(mp_is_square, MP_IS_SQUARE),
       T1(mp_kronecker, MP_KRONECKER),
+      T1(mp_mul_low, MP_MUL_LOW),
       T1(mp_montgomery_reduce, MP_MONTGOMERY_REDUCE),
+      T2(mp_mont_ctx, MP_MONT_CTX_INIT, MP_MONT_EXP),
+      T2(mp_barrett_ctx, MP_BARRETT_CTX_INIT, MP_BARRETT_MULMOD),
+      T2(mp_div_ctx, MP_DIV_CTX_INIT, MP_DIV_WITH_CTX),
+      T1(mp_divexact, MP_DIVEXACT),
+      T1(mp_exptmod_batch, MP_EXPTMOD_BATCH),
+      T1(mp_exptmod_crt, MP_EXPTMOD_CRT),
+      T1(mp_exptmod_ct, MP_EXPTMOD_CT),
+      T1(mp_exptmod_d, MP_EXPTMOD_D),
+      T1(mp_exptmod_multi, MP_EXPTMOD_MULTI),
+      T2(mp_fixed_base, MP_FIXED_BASE_INIT, MP_FIXED_BASE_FROM_BIN),
       T1(mp_root_n, MP_ROOT_N),
       T1(mp_or, MP_OR),
       T1(mp_prime_is_prime, MP_PRIME_IS_PRIME),
@@ -2167,6 +3707,7 @@ static int unit_tests(int argc, char **argv)
       T1(mp_read_write_sbin, MP_TO_SBIN),
       T1(mp_reduce_2k, MP_REDUCE_2K),
       T1(mp_reduce_2k_l, MP_REDUCE_2K_L),
+      T1(mp_reduce_special, MP_REDUCE_SPECIAL),
       T1(mp_radix_size, MP_RADIX_SIZE),
       T1(s_mp_radix_size_overestimate, S_MP_RADIX_SIZE_OVERESTIMATE),
 #if defined(MP_HAS_SET_DOUBLE)
@@ -2177,12 +3718,28 @@ static int unit_tests(int argc, char **argv)
       T1(mp_sqrtmod_prime, MP_SQRTMOD_PRIME),
       T1(mp_xor, MP_XOR),
       T2(s_mp_div_recursive, S_MP_DIV_RECURSIVE, S_MP_DIV_SCHOOL),
+      T2(s_mp_div_newton, S_MP_DIV_NEWTON, S_MP_DIV_SCHOOL),
+      T2(s_mp_divexact, S_MP_DIVEXACT_HENSEL, S_MP_DIVEXACT_SCHOOL),
       T2(s_mp_div_small, S_MP_DIV_SMALL, S_MP_DIV_SCHOOL),
       T1(s_mp_mul_balance, S_MP_MUL_BALANCE),
       T1(s_mp_mul_karatsuba, S_MP_MUL_KARATSUBA),
       T1(s_mp_sqr_karatsuba, S_MP_SQR_KARATSUBA),
       T1(s_mp_mul_toom, S_MP_MUL_TOOM),
-      T1(s_mp_sqr_toom, S_MP_SQR_TOOM)
+      T1(s_mp_sqr_toom, S_MP_SQR_TOOM),
+      T1(s_mp_mul_toom32, S_MP_MUL_TOOM32),
+      T1(s_mp_mul_toom43, S_MP_MUL_TOOM43),
+      T1(s_mp_mul_toom4, S_MP_MUL_TOOM4),
+      T1(s_mp_sqr_toom4, S_MP_SQR_TOOM4),
+      T1(s_mp_mul_fft, S_MP_MUL_FFT),
+      T1(s_mp_sqr_fft, S_MP_SQR_FFT),
+      T1(s_mp_exptmod_even, S_MP_EXPTMOD_EVEN),
+      T2(mp_kernel_name, MP_KERNEL_NAME, MP_CPU_FEATURES),
+#if defined(S_MP_EXPTMOD_IFMA_C)
+      T1(s_mp_exptmod_ifma, S_MP_EXPTMOD_IFMA),
+#endif
+#if defined(S_MP_EXPTMOD4_AVX2_C)
+      T1(s_mp_exptmod4_avx2, S_MP_EXPTMOD4_AVX2),
+#endif
 #undef T2
 #undef T1
    };
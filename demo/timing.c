@@ -138,7 +138,7 @@ int main(int argc, char **argv)
    const char *name;
    int m;
 #endif
-   int n, cnt, ix, old_kara_m, old_kara_s, old_toom_m, old_toom_s;
+   int n, cnt, ix, old_kara_m, old_kara_s, old_toom_m, old_toom_s, old_fft_m, old_fft_s;
    unsigned rr;
 
    CHECK_OK(mp_init(&a));
@@ -246,22 +246,27 @@ int main(int argc, char **argv)
    }
 
    if (should_test("mulsqr", argc, argv) != 0) {
-      /* do mult/square twice, first without karatsuba and second with */
+      /* do mult/square four times, first with the Comba multiplier only, then with Karatsuba, Toom and FFT */
       old_kara_m = MP_MUL_KARATSUBA_CUTOFF;
       old_kara_s = MP_SQR_KARATSUBA_CUTOFF;
-      /* currently toom-cook cut-off is too high to kick in, so we just use the karatsuba values */
+      /* currently toom-cook and FFT cut-offs are too high to kick in, so we just use the karatsuba values */
       old_toom_m = old_kara_m;
       old_toom_s = old_kara_s;
-      for (ix = 0; ix < 3; ix++) {
-         printf("With%s Karatsuba, With%s Toom\n", (ix == 1) ? "" : "out", (ix == 2) ? "" : "out");
+      old_fft_m = old_kara_m;
+      old_fft_s = old_kara_s;
+      for (ix = 0; ix < 4; ix++) {
+         printf("With%s Karatsuba, With%s Toom, With%s FFT\n", (ix == 1) ? "" : "out", (ix == 2) ? "" : "out",
+                (ix == 3) ? "" : "out");
 
          MP_MUL_KARATSUBA_CUTOFF = (ix == 1) ? old_kara_m : 9999;
          MP_SQR_KARATSUBA_CUTOFF = (ix == 1) ? old_kara_s : 9999;
          MP_MUL_TOOM_CUTOFF = (ix == 2) ? old_toom_m : 9999;
          MP_SQR_TOOM_CUTOFF = (ix == 2) ? old_toom_s : 9999;
+         MP_MUL_FFT_CUTOFF = (ix == 3) ? old_fft_m : 9999;
+         MP_SQR_FFT_CUTOFF = (ix == 3) ? old_fft_s : 9999;
 
          log = FOPEN((ix == 0) ? "logs/mult" MP_TIMING_VERSION ".log" : (ix == 1) ? "logs/mult_kara" MP_TIMING_VERSION ".log" :
-                     "logs/mult_toom" MP_TIMING_VERSION ".log", "w");
+                     (ix == 2) ? "logs/mult_toom" MP_TIMING_VERSION ".log" : "logs/mult_fft" MP_TIMING_VERSION ".log", "w");
          for (cnt = 4; cnt <= (10240 / MP_DIGIT_BIT); cnt += 2) {
             SLEEP;
             CHECK_OK(mp_rand(&a, cnt));
@@ -285,7 +290,7 @@ int main(int argc, char **argv)
          printf("\n");
 
          log = FOPEN((ix == 0) ? "logs/sqr" MP_TIMING_VERSION ".log" : (ix == 1) ? "logs/sqr_kara" MP_TIMING_VERSION ".log" :
-                     "logs/sqr_toom" MP_TIMING_VERSION ".log", "w");
+                     (ix == 2) ? "logs/sqr_toom" MP_TIMING_VERSION ".log" : "logs/sqr_fft" MP_TIMING_VERSION ".log", "w");
          for (cnt = 4; cnt <= (10240 / MP_DIGIT_BIT); cnt += 2) {
             SLEEP;
             CHECK_OK(mp_rand(&a, cnt));
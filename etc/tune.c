@@ -20,6 +20,7 @@ static void s_timer_start(void);
 static uint64_t s_timer_stop(void);
 static uint64_t s_time_mul(int size);
 static uint64_t s_time_sqr(int size);
+static uint64_t s_time_div(int size);
 static void s_usage(char *s);
 
 static uint64_t s_timer_function(void)
@@ -146,6 +147,56 @@ LBL_ERR:
    return t1;
 }
 
+/* a dividend of 8 times the digits of the divisor, the quotients mp_div hands to s_mp_div_newton */
+static uint64_t s_time_div(int size)
+{
+   int x;
+   mp_err  e;
+   mp_int  a, b, c, d;
+   uint64_t t1;
+
+   if ((e = mp_init_multi(&a, &b, &c, &d, NULL)) != MP_OKAY) {
+      t1 = UINT64_MAX;
+      goto LBL_ERR;
+   }
+
+   if ((e = mp_rand(&a, 8 * size)) != MP_OKAY) {
+      t1 = UINT64_MAX;
+      goto LBL_ERR;
+   }
+   if ((e = mp_rand(&b, size)) != MP_OKAY) {
+      t1 = UINT64_MAX;
+      goto LBL_ERR;
+   }
+
+   s_timer_start();
+   for (x = 0; x < s_number_of_test_loops; x++) {
+      if ((e = mp_div(&a,&b,&c,&d)) != MP_OKAY) {
+         t1 = UINT64_MAX;
+         goto LBL_ERR;
+      }
+      if (s_check_result == 1) {
+         if ((e = mp_mul(&b,&c,&c)) != MP_OKAY) {
+            t1 = UINT64_MAX;
+            goto LBL_ERR;
+         }
+         if ((e = mp_add(&c,&d,&c)) != MP_OKAY) {
+            t1 = UINT64_MAX;
+            goto LBL_ERR;
+         }
+         if ((mp_cmp(&c, &a) != MP_EQ) || (mp_cmp_mag(&d, &b) != MP_LT)) {
+            t1 = 0u;
+            goto LBL_ERR;
+         }
+      }
+   }
+
+   t1 = s_timer_stop();
+LBL_ERR:
+   mp_clear_multi(&a, &b, &c, &d, NULL);
+   return t1;
+}
+
 struct tune_args {
    int testmode;
    int verbose;
@@ -154,16 +205,18 @@ struct tune_args {
    int terse;
    int upper_limit_print;
    int increment_print;
+   int upper_limit_fft;
+   int increment_fft;
 } args;
 
-static void s_run(const char *name, uint64_t (*op)(int size), int *cutoff)
+static void s_run(const char *name, uint64_t (*op)(int size), int *cutoff, int lower, int upper, int increment)
 {
    int x, count = 0;
    uint64_t t1, t2;
    if ((args.verbose == 1) || (args.testmode == 1)) {
       printf("# %s.\n", name);
    }
-   for (x = 8; x < args.upper_limit_print; x += args.increment_print) {
+   for (x = lower; x < upper; x += increment) {
       *cutoff = INT_MAX;
       t1 = op(x);
       if ((t1 == 0u) || (t1 == UINT64_MAX)) {
@@ -192,7 +245,7 @@ static void s_run(const char *name, uint64_t (*op)(int size), int *cutoff)
          count--;
       }
    }
-   *cutoff = x - s_stabilization_extra * args.increment_print;
+   *cutoff = x - s_stabilization_extra * increment;
 }
 
 static long s_strtol(const char *str, char **endptr, const char *err)
@@ -217,7 +270,7 @@ static long s_strtol(const char *str, char **endptr, const char *err)
 static int s_exit_code = EXIT_FAILURE;
 static void s_usage(char *s)
 {
-   fprintf(stderr,"Usage: %s [TvcpGbtrSLFfMmosh]\n",s);
+   fprintf(stderr,"Usage: %s [TvcpGbtrSLMmFfosh]\n",s);
    fprintf(stderr,"          -T testmode, for use with testme.sh\n");
    fprintf(stderr,"          -v verbose, print all timings\n");
    fprintf(stderr,"          -c check results\n");
@@ -232,15 +285,22 @@ static void s_usage(char *s)
    fprintf(stderr,"          -L [3] number of negative values accumulated until the result is accepted\n");
    fprintf(stderr,"          -M [3000] upper limit of T-C tests/prints\n");
    fprintf(stderr,"          -m [1] increment of T-C tests/prints\n");
+   fprintf(stderr,"          -F [20000] upper limit of FFT tests\n");
+   fprintf(stderr,"          -f [1000] increment of FFT tests\n");
    fprintf(stderr,"          -o [1] multiplier for the second multiplicand\n");
    fprintf(stderr,"             (Not for computing the cut-offs!)\n");
    fprintf(stderr,"          -s 'preset' use values in 'preset' for printing.\n");
    fprintf(stderr,"             'preset' is a comma separated string with cut-offs for\n");
-   fprintf(stderr,"             ksm, kss, tc3m, tc3s in that order\n");
+   fprintf(stderr,"             ksm, kss, tc3m, tc3s[, tc4m, tc4s[, fftm, ffts[, divn]]] in that order\n");
    fprintf(stderr,"             ksm  = karatsuba multiplication\n");
    fprintf(stderr,"             kss  = karatsuba squaring\n");
    fprintf(stderr,"             tc3m = Toom-Cook 3-way multiplication\n");
    fprintf(stderr,"             tc3s = Toom-Cook 3-way squaring\n");
+   fprintf(stderr,"             tc4m = Toom-Cook 4-way multiplication\n");
+   fprintf(stderr,"             tc4s = Toom-Cook 4-way squaring\n");
+   fprintf(stderr,"             fftm = NTT multiplication\n");
+   fprintf(stderr,"             ffts = NTT squaring\n");
+   fprintf(stderr,"             divn = Newton division\n");
    fprintf(stderr,"             Implies '-p'\n");
    fprintf(stderr,"          -h this message\n");
    exit(s_exit_code);
@@ -249,10 +309,13 @@ static void s_usage(char *s)
 struct cutoffs {
    int MUL_KARATSUBA, SQR_KARATSUBA;
    int MUL_TOOM, SQR_TOOM;
+   int MUL_TOOM4, SQR_TOOM4;
+   int MUL_FFT, SQR_FFT;
+   int DIV_NEWTON;
 };
 
 const struct cutoffs max_cutoffs =
-{ INT_MAX, INT_MAX, INT_MAX, INT_MAX };
+{ INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX, INT_MAX };
 
 static void set_cutoffs(const struct cutoffs *c)
 {
@@ -260,6 +323,11 @@ static void set_cutoffs(const struct cutoffs *c)
    MP_SQR_KARATSUBA_CUTOFF = c->SQR_KARATSUBA;
    MP_MUL_TOOM_CUTOFF = c->MUL_TOOM;
    MP_SQR_TOOM_CUTOFF = c->SQR_TOOM;
+   MP_MUL_TOOM4_CUTOFF = c->MUL_TOOM4;
+   MP_SQR_TOOM4_CUTOFF = c->SQR_TOOM4;
+   MP_MUL_FFT_CUTOFF = c->MUL_FFT;
+   MP_SQR_FFT_CUTOFF = c->SQR_FFT;
+   MP_DIV_NEWTON_CUTOFF = c->DIV_NEWTON;
 }
 
 static void get_cutoffs(struct cutoffs *c)
@@ -268,6 +336,11 @@ static void get_cutoffs(struct cutoffs *c)
    c->SQR_KARATSUBA  = MP_SQR_KARATSUBA_CUTOFF;
    c->MUL_TOOM = MP_MUL_TOOM_CUTOFF;
    c->SQR_TOOM = MP_SQR_TOOM_CUTOFF;
+   c->MUL_TOOM4 = MP_MUL_TOOM4_CUTOFF;
+   c->SQR_TOOM4 = MP_SQR_TOOM4_CUTOFF;
+   c->MUL_FFT = MP_MUL_FFT_CUTOFF;
+   c->SQR_FFT = MP_SQR_FFT_CUTOFF;
+   c->DIV_NEWTON = MP_DIV_NEWTON_CUTOFF;
 
 }
 
@@ -302,6 +375,8 @@ int main(int argc, char **argv)
 
    args.upper_limit_print = 3000;
    args.increment_print = 1;
+   args.upper_limit_fft = 20000;
+   args.increment_fft = 1000;
 
    /* Very simple option parser, please treat it nicely. */
    if (argc != 1) {
@@ -312,6 +387,8 @@ int main(int argc, char **argv)
             s_check_result = 1;
             args.upper_limit_print = 1000;
             args.increment_print = 11;
+            args.upper_limit_fft = 1000;
+            args.increment_fft = 111;
             s_number_of_test_loops = 1;
             s_stabilization_extra = 1;
             s_offset = 1;
@@ -406,6 +483,20 @@ int main(int argc, char **argv)
             }
             args.increment_print = (int)s_strtol(argv[opt], NULL, "No value for the increment for the T-C tests given");
             break;
+         case 'F':
+            opt++;
+            if (opt >= argc) {
+               s_usage(argv[0]);
+            }
+            args.upper_limit_fft = (int)s_strtol(argv[opt], NULL, "No value for the upper limit of FFT tests given");
+            break;
+         case 'f':
+            opt++;
+            if (opt >= argc) {
+               s_usage(argv[0]);
+            }
+            args.increment_fft = (int)s_strtol(argv[opt], NULL, "No value for the increment for the FFT tests given");
+            break;
          case 's':
             printpreset = 1;
             args.print = 1;
@@ -421,6 +512,23 @@ int main(int argc, char **argv)
             MP_MUL_TOOM_CUTOFF = (int)s_strtol(str, &endptr, "[3/4] No value for MP_MUL_TOOM_CUTOFF given");
             str = endptr + 1;
             MP_SQR_TOOM_CUTOFF = (int)s_strtol(str, &endptr, "[4/4] No value for MP_SQR_TOOM_CUTOFF given");
+            /* the Toom-Cook 4-way, FFT and Newton division cut-offs are optional */
+            if (*endptr == ',') {
+               str = endptr + 1;
+               MP_MUL_TOOM4_CUTOFF = (int)s_strtol(str, &endptr, "[5/9] No value for MP_MUL_TOOM4_CUTOFF given");
+               str = endptr + 1;
+               MP_SQR_TOOM4_CUTOFF = (int)s_strtol(str, &endptr, "[6/9] No value for MP_SQR_TOOM4_CUTOFF given");
+            }
+            if (*endptr == ',') {
+               str = endptr + 1;
+               MP_MUL_FFT_CUTOFF = (int)s_strtol(str, &endptr, "[7/9] No value for MP_MUL_FFT_CUTOFF given");
+               str = endptr + 1;
+               MP_SQR_FFT_CUTOFF = (int)s_strtol(str, &endptr, "[8/9] No value for MP_SQR_FFT_CUTOFF given");
+            }
+            if (*endptr == ',') {
+               str = endptr + 1;
+               MP_DIV_NEWTON_CUTOFF = (int)s_strtol(str, &endptr, "[9/9] No value for MP_DIV_NEWTON_CUTOFF given");
+            }
             break;
          case 'h':
             s_exit_code = EXIT_SUCCESS;
@@ -459,29 +567,66 @@ int main(int argc, char **argv)
          T_MUL_SQR("Karatsuba squaring", SQR_KARATSUBA, s_time_sqr),
          T_MUL_SQR("Toom-Cook 3-way multiplying", MUL_TOOM, s_time_mul),
          T_MUL_SQR("Toom-Cook 3-way squaring", SQR_TOOM, s_time_sqr),
+#undef T_MUL_SQR
+      };
+      struct {
+         const char *name;
+         int *cutoff, *update;
+         uint64_t (*fn)(int size);
+         int *upper, *increment;
+      } test_upper[] = {
+#define T_MUL_SQR(n, o, f, u, i)  { #n, &MP_##o##_CUTOFF, &(updated.o), MP_HAS(S_MP_##o) ? f : NULL, &(args.u), &(args.i) }
+         T_MUL_SQR("Toom-Cook 4-way multiplying", MUL_TOOM4, s_time_mul, upper_limit_print, increment_print),
+         T_MUL_SQR("Toom-Cook 4-way squaring", SQR_TOOM4, s_time_sqr, upper_limit_print, increment_print),
+         T_MUL_SQR("NTT multiplying", MUL_FFT, s_time_mul, upper_limit_fft, increment_fft),
+         T_MUL_SQR("NTT squaring", SQR_FFT, s_time_sqr, upper_limit_fft, increment_fft),
+         T_MUL_SQR("Newton division", DIV_NEWTON, s_time_div, upper_limit_print, increment_print),
 #undef T_MUL_SQR
       };
       /* Turn all limits from bncore.c to the max */
       set_cutoffs(&max_cutoffs);
       for (n = 0; n < sizeof(test)/sizeof(test[0]); ++n) {
          if (test[n].fn != NULL) {
-            s_run(test[n].name, test[n].fn, test[n].cutoff);
+            s_run(test[n].name, test[n].fn, test[n].cutoff, 8, args.upper_limit_print, args.increment_print);
             *test[n].update = *test[n].cutoff;
             *test[n].cutoff = INT_MAX;
          }
       }
+      /*
+         Toom-Cook 4-way, the NTT and the Newton division have to compete
+         with the algorithms below them, not with the Comba multiplier, so
+         they run with the cut-offs found so far.
+       */
+      for (n = 0; n < sizeof(test_upper)/sizeof(test_upper[0]); ++n) {
+         if (test_upper[n].fn != NULL) {
+            set_cutoffs(&updated);
+            s_run(test_upper[n].name, test_upper[n].fn, test_upper[n].cutoff,
+                  MP_MAX(8, *test_upper[n].increment), *test_upper[n].upper, *test_upper[n].increment);
+            *test_upper[n].update = *test_upper[n].cutoff;
+         }
+      }
    }
    if (args.terse == 1) {
-      printf("%d %d %d %d\n",
+      printf("%d %d %d %d %d %d %d %d %d\n",
              updated.MUL_KARATSUBA,
              updated.SQR_KARATSUBA,
              updated.MUL_TOOM,
-             updated.SQR_TOOM);
+             updated.SQR_TOOM,
+             updated.MUL_TOOM4,
+             updated.SQR_TOOM4,
+             updated.MUL_FFT,
+             updated.SQR_FFT,
+             updated.DIV_NEWTON);
    } else {
       printf("MUL_KARATSUBA_CUTOFF = %d\n", updated.MUL_KARATSUBA);
       printf("SQR_KARATSUBA_CUTOFF = %d\n", updated.SQR_KARATSUBA);
       printf("MUL_TOOM_CUTOFF = %d\n", updated.MUL_TOOM);
       printf("SQR_TOOM_CUTOFF = %d\n", updated.SQR_TOOM);
+      printf("MUL_TOOM4_CUTOFF = %d\n", updated.MUL_TOOM4);
+      printf("SQR_TOOM4_CUTOFF = %d\n", updated.SQR_TOOM4);
+      printf("MUL_FFT_CUTOFF = %d\n", updated.MUL_FFT);
+      printf("SQR_FFT_CUTOFF = %d\n", updated.SQR_FFT);
+      printf("DIV_NEWTON_CUTOFF = %d\n", updated.DIV_NEWTON);
    }
 
    if (args.print == 1) {
@@ -525,16 +670,26 @@ int main(int argc, char **argv)
       if (args.verbose == 1) {
          set_cutoffs(&orig);
          if (args.terse == 1) {
-            printf("%d %d %d %d\n",
+            printf("%d %d %d %d %d %d %d %d %d\n",
                    MP_MUL_KARATSUBA_CUTOFF,
                    MP_SQR_KARATSUBA_CUTOFF,
                    MP_MUL_TOOM_CUTOFF,
-                   MP_SQR_TOOM_CUTOFF);
+                   MP_SQR_TOOM_CUTOFF,
+                   MP_MUL_TOOM4_CUTOFF,
+                   MP_SQR_TOOM4_CUTOFF,
+                   MP_MUL_FFT_CUTOFF,
+                   MP_SQR_FFT_CUTOFF,
+                   MP_DIV_NEWTON_CUTOFF);
          } else {
             printf("MUL_KARATSUBA_CUTOFF = %d\n", MP_MUL_KARATSUBA_CUTOFF);
             printf("SQR_KARATSUBA_CUTOFF = %d\n", MP_SQR_KARATSUBA_CUTOFF);
             printf("MUL_TOOM_CUTOFF = %d\n", MP_MUL_TOOM_CUTOFF);
             printf("SQR_TOOM_CUTOFF = %d\n", MP_SQR_TOOM_CUTOFF);
+            printf("MUL_TOOM4_CUTOFF = %d\n", MP_MUL_TOOM4_CUTOFF);
+            printf("SQR_TOOM4_CUTOFF = %d\n", MP_SQR_TOOM4_CUTOFF);
+            printf("MUL_FFT_CUTOFF = %d\n", MP_MUL_FFT_CUTOFF);
+            printf("SQR_FFT_CUTOFF = %d\n", MP_SQR_FFT_CUTOFF);
+            printf("DIV_NEWTON_CUTOFF = %d\n", MP_DIV_NEWTON_CUTOFF);
          }
       }
    }
@@ -56,7 +56,7 @@ KEEP_TEMP=1
 echo "You might like to watch the numbers go up to $LIMIT but it will take a long time!"
 
 # Might not have sufficient rights or disc full.
-echo "km ks tc3m tc3s" > $FILE_NAME || die "Writing header to $FILE_NAME" $?
+echo "km ks tc3m tc3s tc4m tc4s fftm ffts divn" > $FILE_NAME || die "Writing header to $FILE_NAME" $?
 i=1
 while [ $i -le $LIMIT ]; do
    RNUM=$(LCG)
@@ -104,3 +104,18 @@ echo "#define MP_DEFAULT_MUL_TOOM_CUTOFF      $TMP" >> $TOMMATH_CUTOFFS_H || die
 TMP=$(median $FILE_NAME 4 $i)
 echo "#define MP_DEFAULT_SQR_TOOM_CUTOFF      $TMP"
 echo "#define MP_DEFAULT_SQR_TOOM_CUTOFF      $TMP" >> $TOMMATH_CUTOFFS_H || die "(tc3s) Appending to $TOMMATH_CUTOFFS_H" $?
+TMP=$(median $FILE_NAME 5 $i)
+echo "#define MP_DEFAULT_MUL_TOOM4_CUTOFF     $TMP"
+echo "#define MP_DEFAULT_MUL_TOOM4_CUTOFF     $TMP" >> $TOMMATH_CUTOFFS_H || die "(tc4m) Appending to $TOMMATH_CUTOFFS_H" $?
+TMP=$(median $FILE_NAME 6 $i)
+echo "#define MP_DEFAULT_SQR_TOOM4_CUTOFF     $TMP"
+echo "#define MP_DEFAULT_SQR_TOOM4_CUTOFF     $TMP" >> $TOMMATH_CUTOFFS_H || die "(tc4s) Appending to $TOMMATH_CUTOFFS_H" $?
+TMP=$(median $FILE_NAME 7 $i)
+echo "#define MP_DEFAULT_MUL_FFT_CUTOFF       $TMP"
+echo "#define MP_DEFAULT_MUL_FFT_CUTOFF       $TMP" >> $TOMMATH_CUTOFFS_H || die "(fftm) Appending to $TOMMATH_CUTOFFS_H" $?
+TMP=$(median $FILE_NAME 8 $i)
+echo "#define MP_DEFAULT_SQR_FFT_CUTOFF       $TMP"
+echo "#define MP_DEFAULT_SQR_FFT_CUTOFF       $TMP" >> $TOMMATH_CUTOFFS_H || die "(ffts) Appending to $TOMMATH_CUTOFFS_H" $?
+TMP=$(median $FILE_NAME 9 $i)
+echo "#define MP_DEFAULT_DIV_NEWTON_CUTOFF    $TMP"
+echo "#define MP_DEFAULT_DIV_NEWTON_CUTOFF    $TMP" >> $TOMMATH_CUTOFFS_H || die "(divn) Appending to $TOMMATH_CUTOFFS_H" $?
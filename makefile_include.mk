@@ -105,6 +105,15 @@ ifeq ($(PLATFORM), CYGWIN)
 LIBTOOLFLAGS += -no-undefined
 endif
 
+# s_mp_parallel uses POSIX threads except on Windows, -DMP_NO_THREADS builds without them
+ifeq (,$(findstring MP_NO_THREADS,$(CFLAGS)))
+ifeq (,$(findstring $(PLATFORM),MINGW32 MINGW64 MSYS)$(findstring mingw,$(CC)))
+LTM_CFLAGS += -pthread
+LTM_LFLAGS += -pthread
+LTM_LDFLAGS += -pthread
+endif
+endif
+
 # add in the standard FLAGS
 LTM_CFLAGS += $(CFLAGS)
 LTM_LFLAGS += $(LFLAGS)
@@ -0,0 +1,23 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_ADDMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* d = a + b (mod N) */
+mp_err mp_barrett_addmod(const mp_int *a, const mp_int *b, const mp_barrett_ctx *ctx, mp_int *d)
+{
+   mp_err err;
+
+   if ((err = mp_add(a, b, d)) != MP_OKAY) {
+      return err;
+   }
+
+   /* the sum of two reduced values needs at most one subtraction */
+   if (!mp_isneg(d) && (mp_cmp_mag(d, &ctx->N) != MP_LT)) {
+      if ((err = s_mp_sub(d, &ctx->N, d)) != MP_OKAY) {
+         return err;
+      }
+   }
+   return mp_barrett_mod(d, ctx, d);
+}
+#endif
@@ -0,0 +1,10 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_CTX_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+void mp_barrett_ctx_clear(mp_barrett_ctx *ctx)
+{
+   mp_clear_multi(&ctx->N, &ctx->mu, NULL);
+}
+#endif
@@ -0,0 +1,26 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+mp_err mp_barrett_ctx_init(mp_barrett_ctx *ctx, const mp_int *N)
+{
+   mp_err err;
+
+   if (mp_isneg(N) || mp_iszero(N)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&ctx->N, &ctx->mu, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_copy(N, &ctx->N)) != MP_OKAY)                                 goto LBL_ERR;
+   if ((err = mp_reduce_setup(&ctx->mu, N)) != MP_OKAY)                        goto LBL_ERR;
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&ctx->N, &ctx->mu, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,31 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_MOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Barrett reduction of |a| < B**(2*N.used), anything larger goes through mp_mod */
+mp_err mp_barrett_mod(const mp_int *a, const mp_barrett_ctx *ctx, mp_int *c)
+{
+   mp_err err;
+   bool neg = mp_isneg(a);
+
+   if (a->used > (2 * ctx->N.used)) {
+      return mp_mod(a, &ctx->N, c);
+   }
+
+   if ((err = mp_abs(a, c)) != MP_OKAY) {
+      return err;
+   }
+   if (mp_cmp_mag(c, &ctx->N) != MP_LT) {
+      if ((err = mp_reduce(c, &ctx->N, &ctx->mu)) != MP_OKAY) {
+         return err;
+      }
+   }
+
+   /* -|a| mod N = N - (|a| mod N) */
+   if (neg && !mp_iszero(c)) {
+      return mp_sub(&ctx->N, c, c);
+   }
+   return MP_OKAY;
+}
+#endif
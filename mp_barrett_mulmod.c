@@ -0,0 +1,15 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_MULMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* d = a * b (mod N) */
+mp_err mp_barrett_mulmod(const mp_int *a, const mp_int *b, const mp_barrett_ctx *ctx, mp_int *d)
+{
+   mp_err err;
+   if ((err = mp_mul(a, b, d)) != MP_OKAY) {
+      return err;
+   }
+   return mp_barrett_mod(d, ctx, d);
+}
+#endif
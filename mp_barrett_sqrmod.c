@@ -0,0 +1,15 @@
+#include "tommath_private.h"
+#ifdef MP_BARRETT_SQRMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * a (mod N) */
+mp_err mp_barrett_sqrmod(const mp_int *a, const mp_barrett_ctx *ctx, mp_int *c)
+{
+   mp_err err;
+   if ((err = mp_sqr(a, c)) != MP_OKAY) {
+      return err;
+   }
+   return mp_barrett_mod(c, ctx, c);
+}
+#endif
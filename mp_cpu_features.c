@@ -0,0 +1,94 @@
+#include "tommath_private.h"
+#ifdef MP_CPU_FEATURES_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* On x86-64 the features are read with CPUID, the vector extensions
+ * additionally need the OS to save their registers which XGETBV tells.
+ * On aarch64 the Advanced SIMD instructions are always there, Linux
+ * reports the optional ones in the auxiliary vector.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define S_CPU_X86
+#include <cpuid.h>
+
+static void s_cpuid(unsigned int leaf, unsigned int *r)
+{
+   __cpuid_count(leaf, 0u, r[0], r[1], r[2], r[3]);
+}
+
+static uint64_t s_xgetbv(void)
+{
+   uint32_t lo, hi;
+   __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+   return (((uint64_t)hi) << 32) | lo;
+}
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+#define S_CPU_X86
+#include <intrin.h>
+
+static void s_cpuid(unsigned int leaf, unsigned int *r)
+{
+   int i, t[4];
+   __cpuidex(t, (int)leaf, 0);
+   for (i = 0; i < 4; i++) {
+      r[i] = (unsigned int)t[i];
+   }
+}
+
+static uint64_t s_xgetbv(void)
+{
+   return (uint64_t)_xgetbv(0);
+}
+#elif defined(__aarch64__) && defined(__linux__)
+#define S_CPU_AUXV
+#include <sys/auxv.h>
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1uL << 22)
+#endif
+#endif
+
+unsigned int mp_cpu_features(void)
+{
+   unsigned int features = 0u;
+#if defined(S_CPU_X86)
+   unsigned int r[4];
+   uint64_t xcr0 = 0u;
+
+   s_cpuid(0u, r);
+   if (r[0] < 7u) {
+      return 0u;
+   }
+   s_cpuid(1u, r);
+   if ((r[2] & (1u << 27)) != 0u) { /* OSXSAVE */
+      xcr0 = s_xgetbv();
+   }
+   s_cpuid(7u, r);
+   if ((r[1] & (1u << 8)) != 0u) {
+      features |= MP_CPU_BMI2;
+   }
+   if ((r[1] & (1u << 19)) != 0u) {
+      features |= MP_CPU_ADX;
+   }
+   /* XMM and YMM state */
+   if (((xcr0 & 0x06u) == 0x06u) && ((r[1] & (1u << 5)) != 0u)) {
+      features |= MP_CPU_AVX2;
+   }
+   /* additionally the opmask and the ZMM state */
+   if (((xcr0 & 0xE6u) == 0xE6u) && ((r[1] & (1u << 16)) != 0u)) {
+      features |= MP_CPU_AVX512F;
+      if ((r[1] & (1u << 21)) != 0u) {
+         features |= MP_CPU_AVX512IFMA;
+      }
+   }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+   features |= MP_CPU_ASIMD;
+#  if defined(S_CPU_AUXV)
+   if ((getauxval(AT_HWCAP) & HWCAP_SVE) != 0u) {
+      features |= MP_CPU_SVE;
+   }
+#  endif
+#endif
+   return features;
+}
+#endif
@@ -25,7 +25,11 @@ mp_err mp_div(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d)
       return MP_OKAY;
    }
 
-   if (MP_HAS(S_MP_DIV_RECURSIVE)
+   if (MP_HAS(S_MP_DIV_NEWTON)
+       && (b->used >= MP_DIV_NEWTON_CUTOFF)
+       && (b->used <= (a->used / 4))) {
+      err = s_mp_div_newton(a, b, NULL, c, d);
+   } else if (MP_HAS(S_MP_DIV_RECURSIVE)
        && (b->used > (2 * MP_MUL_KARATSUBA_CUTOFF))
        && (b->used <= ((a->used/3)*2))) {
       err = s_mp_div_recursive(a, b, c, d);
@@ -0,0 +1,33 @@
+#include "tommath_private.h"
+#ifdef MP_DIV_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+mp_err mp_div_ctx_init(mp_div_ctx *ctx, const mp_int *N)
+{
+   mp_err err;
+
+   if (mp_iszero(N)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&ctx->N, &ctx->v, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_copy(N, &ctx->N)) != MP_OKAY)                                 goto LBL_ERR;
+
+   /* the reciprocal for the Barrett steps of s_mp_div_newton */
+   if (MP_HAS(S_MP_DIV_NEWTON) && (N->used >= MP_DIV_CTX_MIN_DIGITS)) {
+      ctx->N.sign = MP_ZPOS;
+      err = s_mp_div_recip(&ctx->N, &ctx->v);
+      ctx->N.sign = N->sign;
+      if (err != MP_OKAY)                                                      goto LBL_ERR;
+   }
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&ctx->N, &ctx->v, NULL);
+   return err;
+}
+#endif
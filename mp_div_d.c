@@ -8,6 +8,7 @@ mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d)
 {
    mp_int  q;
    mp_word w;
+   mp_digit_recip r;
    mp_err err;
    int ix;
 
@@ -50,13 +51,22 @@ mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d)
       return s_mp_div_3(a, c, d);
    }
 
+   /* longer inputs are multiplied with a reciprocal of b, see s_mp_div_d_recip */
+   if (MP_HAS(S_MP_DIGIT_RECIP) && MP_HAS(S_MP_DIV_D_RECIP)
+       && (a->used >= ((c == NULL) ? MP_MOD_D_RECIP_MIN_DIGITS : MP_DIV_D_RECIP_MIN_DIGITS))) {
+      s_mp_digit_recip(b, &r);
+      return s_mp_div_d_recip(a, &r, c, d);
+   }
+
    /* no easy answer [c'est la vie].  Just division */
-   if ((err = mp_init_size(&q, a->used)) != MP_OKAY) {
-      return err;
+   if (c != NULL) {
+      if ((err = mp_init_size(&q, a->used)) != MP_OKAY) {
+         return err;
+      }
+      q.used = a->used;
+      q.sign = a->sign;
    }
 
-   q.used = a->used;
-   q.sign = a->sign;
    w = 0;
    for (ix = a->used; ix --> 0;) {
       mp_digit t = 0;
@@ -65,7 +75,9 @@ mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d)
          t = (mp_digit)(w / b);
          w -= (mp_word)t * (mp_word)b;
       }
-      q.dp[ix] = t;
+      if (c != NULL) {
+         q.dp[ix] = t;
+      }
    }
 
    if (d != NULL) {
@@ -75,8 +87,8 @@ mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d)
    if (c != NULL) {
       mp_clamp(&q);
       mp_exch(&q, c);
+      mp_clear(&q);
    }
-   mp_clear(&q);
 
    return MP_OKAY;
 }
@@ -0,0 +1,20 @@
+#include "tommath_private.h"
+#ifdef MP_DIV_WITH_CTX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* mp_div by the divisor of the context
+ *
+ * With the reciprocal of the context every n digits of the quotient cost
+ * one product and one short product, whatever the size of the divisor.
+ * The normalization of the divisor and the splits of s_mp_div_recursive
+ * are linear in n and not worth keeping.
+ */
+mp_err mp_div_with_ctx(const mp_int *a, const mp_div_ctx *ctx, mp_int *c, mp_int *d)
+{
+   if (mp_iszero(&ctx->v) || (mp_cmp_mag(a, &ctx->N) == MP_LT)) {
+      return mp_div(a, &ctx->N, c, d);
+   }
+   return s_mp_div_newton(a, &ctx->N, &ctx->v, c, d);
+}
+#endif
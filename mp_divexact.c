@@ -0,0 +1,57 @@
+#include "tommath_private.h"
+#ifdef MP_DIVEXACT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a / b if b divides a, anything else if it does not
+ *
+ * Common factors of two are shifted out, the division by the odd rest of
+ * b works from the low digits and needs no trial quotients.  The 2-adic
+ * inverse of s_mp_divexact_hensel pays off once it serves a few blocks of
+ * the quotient or the operands are large, below the schoolbook loop wins.
+ */
+mp_err mp_divexact(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int x, y;
+   int k, n, m;
+   bool neg = (a->sign != b->sign);
+   mp_err err;
+
+   if (mp_iszero(b)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&x, &y, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   k = mp_cnt_lsb(b);
+   if ((err = mp_div_2d(a, k, &x, NULL)) != MP_OKAY)              goto LBL_ERR;
+   if ((err = mp_div_2d(b, k, &y, NULL)) != MP_OKAY)              goto LBL_ERR;
+   x.sign = y.sign = MP_ZPOS;
+
+   /* the digits of the shorter and of the longer one of divisor and quotient */
+   n = MP_MIN(y.used, (x.used - y.used) + 1);
+   m = MP_MAX(y.used, (x.used - y.used) + 1);
+
+   if (mp_cmp_d(&y, 1uL) == MP_EQ) {
+      mp_exch(&x, c);
+   } else if (MP_HAS(S_MP_DIVEXACT_HENSEL)
+              && (n >= MP_DIVEXACT_HENSEL_MIN_DIGITS)
+              && ((m >= (2 * n)) || (n >= (16 * MP_DIVEXACT_HENSEL_MIN_DIGITS)))) {
+      err = s_mp_divexact_hensel(&x, &y, c);
+   } else if (MP_HAS(S_MP_DIVEXACT_SCHOOL)) {
+      err = s_mp_divexact_school(&x, &y, c);
+   } else {
+      err = mp_div(&x, &y, c, NULL);
+   }
+
+   if ((err == MP_OKAY) && !mp_iszero(c)) {
+      c->sign = neg ? MP_NEG : MP_ZPOS;
+   }
+
+LBL_ERR:
+   mp_clear_multi(&x, &y, NULL);
+   return err;
+}
+#endif
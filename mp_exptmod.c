@@ -47,9 +47,25 @@ LBL_ERR:
       return err;
    }
 
+   /* short exponents with few ones like 3 or 65537 do without the window table */
+   if (MP_HAS(MP_EXPTMOD_D) && (mp_count_bits(X) <= 32)) {
+      uint32_t e = mp_get_u32(X), u;
+      int ones = 0;
+      for (u = e; u != 0u; u &= u - 1u) {
+         ones++;
+      }
+      if (ones <= MP_EXPTMOD_SHORT_ONES(mp_count_bits(X))) {
+         return mp_exptmod_d(G, e, P, Y);
+      }
+   }
+
    /* modified diminished radix reduction */
    if (MP_HAS(MP_REDUCE_IS_2K_L) && MP_HAS(MP_REDUCE_2K_L) && MP_HAS(S_MP_EXPTMOD) &&
        mp_reduce_is_2k_l(P)) {
+      /* the primes of mp_reduce_special are faster with their own reduction */
+      if (MP_HAS(MP_REDUCE_IS_SPECIAL) && MP_HAS(S_MP_EXPTMOD_FAST) && mp_reduce_is_special(P)) {
+         return s_mp_exptmod_fast(G, X, P, Y, 3);
+      }
       return s_mp_exptmod(G, X, P, Y, 1);
    }
 
@@ -61,11 +77,21 @@ LBL_ERR:
       dr = (mp_reduce_is_2k(P)) ? 2 : 0;
    }
 
+   /* and than mp_reduce_2k, for the others Montgomery reduction is as fast */
+   if (MP_HAS(MP_REDUCE_IS_SPECIAL) && (dr == 2) && mp_reduce_is_special(P)) {
+      dr = 3;
+   }
+
    /* if the modulus is odd or dr != 0 use the montgomery method */
    if (MP_HAS(S_MP_EXPTMOD_FAST) && (mp_isodd(P) || (dr != 0))) {
       return s_mp_exptmod_fast(G, X, P, Y, dr);
    }
 
+   /* even moduli split into an odd one and a power of two */
+   if (MP_HAS(S_MP_EXPTMOD_EVEN) && !mp_iszero(P)) {
+      return s_mp_exptmod_even(G, X, P, Y);
+   }
+
    /* otherwise use the generic Barrett reduction technique */
    if (MP_HAS(S_MP_EXPTMOD)) {
       return s_mp_exptmod(G, X, P, Y, 0);
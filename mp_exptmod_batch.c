@@ -0,0 +1,152 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_BATCH_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y[i] == G[i]**X[i] mod P[i] for i < n on up to nthreads threads
+ *
+ * The jobs are cut into chunks of consecutive jobs, about eight per thread,
+ * which are spread over the threads by s_mp_parallel.  A chunk keeps the
+ * Montgomery context of its modulus as long as the following jobs have the
+ * same one, runs of the same modulus are best passed next to each other.
+ * Everything mp_exptmod does not do with Montgomery reduction goes through
+ * mp_exptmod.
+ *
+ * If the host CPU has a kernel for four exponentiations at once, the chunks
+ * start at multiples of four and every four consecutive jobs it can do go
+ * to that kernel, see s_mp_exptmod4_avx2.
+ */
+
+#define MP_BATCH_CHUNKS_PER_THREAD 8
+
+typedef struct {
+   const mp_int *const *G, *const *X, *const *P;
+   mp_int *const *Y;
+   int start, end;
+   mp_err err;
+} s_batch_chunk;
+
+/* true if mp_exptmod would use Montgomery reduction for P */
+static bool s_is_mont(const mp_int *P)
+{
+   return mp_isodd(P) && !mp_isneg(P) && (mp_cmp_d(P, 1u) == MP_GT) &&
+          !(MP_HAS(MP_DR_IS_MODULUS) && mp_dr_is_modulus(P)) &&
+          !(MP_HAS(MP_REDUCE_IS_2K) && mp_reduce_is_2k(P));
+}
+
+/* true if the jobs i to i+3 can go to the exptmod4 kernel */
+static bool s_is_quad(const s_batch_chunk *c, int i, const mp_kernel_table *kernels)
+{
+   int k;
+
+   if ((kernels->exptmod4 == NULL) || ((i + 4) > c->end)) {
+      return false;
+   }
+   for (k = i; k < (i + 4); k++) {
+      if (!mp_isodd(c->P[k]) || mp_isneg(c->P[k]) || (mp_cmp_d(c->P[k], 1u) != MP_GT) || mp_isneg(c->X[k]) ||
+          (mp_count_bits(c->P[k]) > kernels->exptmod4_max_bits)) {
+         return false;
+      }
+   }
+   return true;
+}
+
+static mp_err s_batch_run(const s_batch_chunk *c)
+{
+   mp_mont_ctx ctx;
+   bool have_ctx = false, mont = false;
+   const mp_kernel_table *kernels = s_mp_kernels();
+   mp_int t;
+   int i;
+   mp_err err;
+
+   if ((err = mp_init(&t)) != MP_OKAY) {
+      return err;
+   }
+   for (i = c->start; i < c->end; i++) {
+      if ((((i - c->start) % 4) == 0) && s_is_quad(c, i, kernels)) {
+         if ((err = kernels->exptmod4(c->G + i, c->X + i, c->P + i, c->Y + i)) != MP_OKAY) goto LBL_ERR;
+         i += 3;
+         continue;
+      }
+      if (!(have_ctx && (mp_cmp(c->P[i], &ctx.N) == MP_EQ))) {
+         if (have_ctx) {
+            mp_mont_ctx_clear(&ctx);
+            have_ctx = false;
+         }
+         mont = s_is_mont(c->P[i]);
+         if (mont) {
+            if ((err = mp_mont_ctx_init(&ctx, c->P[i])) != MP_OKAY) goto LBL_ERR;
+            have_ctx = true;
+         }
+      }
+      if (!mont || mp_isneg(c->X[i])) {
+         if ((err = mp_exptmod(c->G[i], c->X[i], c->P[i], c->Y[i])) != MP_OKAY) goto LBL_ERR;
+         continue;
+      }
+      if ((err = mp_to_mont(c->G[i], &ctx, &t)) != MP_OKAY)           goto LBL_ERR;
+      if ((err = mp_mont_exp(&t, c->X[i], &ctx, &t)) != MP_OKAY)       goto LBL_ERR;
+      if ((err = mp_from_mont(&t, &ctx, c->Y[i])) != MP_OKAY)          goto LBL_ERR;
+   }
+
+LBL_ERR:
+   if (have_ctx) {
+      mp_mont_ctx_clear(&ctx);
+   }
+   mp_clear(&t);
+   return err;
+}
+
+static void s_batch_chunk_run(void *arg)
+{
+   s_batch_chunk *c = (s_batch_chunk *)arg;
+   c->err = s_batch_run(c);
+}
+
+mp_err mp_exptmod_batch(const mp_int *const G[], const mp_int *const X[], const mp_int *const P[], mp_int *const Y[],
+                        int n, int nthreads)
+{
+   s_batch_chunk *c;
+   int i, chunks, unit;
+   mp_err err;
+
+   if ((n < 0) || (nthreads < 1)) {
+      return MP_VAL;
+   }
+   if (n == 0) {
+      return MP_OKAY;
+   }
+
+   /* chunks of whole groups of four for the exptmod4 kernel */
+   unit = (s_mp_kernels()->exptmod4 != NULL) ? 4 : 1;
+   chunks = (nthreads == 1) ? 1 : (int)MP_MIN((int64_t)((n + unit - 1) / unit),
+                                              (int64_t)nthreads * MP_BATCH_CHUNKS_PER_THREAD);
+   c = (s_batch_chunk *) MP_CALLOC((size_t)chunks, sizeof(*c));
+   if (c == NULL) {
+      return MP_MEM;
+   }
+   for (i = 0; i < chunks; i++) {
+      c[i].G = G;
+      c[i].X = X;
+      c[i].P = P;
+      c[i].Y = Y;
+      c[i].start = MP_MIN(unit * (int)(((int64_t)((n + unit - 1) / unit) * i) / chunks), n);
+      c[i].end = MP_MIN(unit * (int)(((int64_t)((n + unit - 1) / unit) * (i + 1)) / chunks), n);
+   }
+
+   if (MP_HAS(S_MP_PARALLEL)) {
+      s_mp_parallel(s_batch_chunk_run, c, sizeof(*c), chunks, nthreads);
+   } else {
+      for (i = 0; i < chunks; i++) {
+         s_batch_chunk_run(&c[i]);
+      }
+   }
+
+   err = MP_OKAY;
+   for (i = 0; (i < chunks) && (err == MP_OKAY); i++) {
+      err = c[i].err;
+   }
+   MP_FREE(c, (size_t)chunks * sizeof(*c));
+   return err;
+}
+#endif
@@ -0,0 +1,70 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_CRT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes M == C**d mod p*q from the CRT parameters of d
+ *
+ * m1 = C**dp mod p and m2 = C**dq mod q are two exponentiations with half
+ * the size of the modulus and of the exponent, together about four times
+ * faster than one with p*q, they are independent and can run in parallel.
+ * The results are combined with Garner's formula
+ *
+ *    M = m2 + q * (qinv * (m1 - m2) mod p)
+ */
+
+typedef struct {
+   const mp_int *G, *X, *P;
+   mp_int *Y;
+   mp_err err;
+} s_crt_half;
+
+static void s_crt_exptmod(void *arg)
+{
+   s_crt_half *h = (s_crt_half *)arg;
+   h->err = mp_exptmod(h->G, h->X, h->P, h->Y);
+}
+
+mp_err mp_exptmod_crt(const mp_int *C, const mp_int *p, const mp_int *q, const mp_int *dp, const mp_int *dq,
+                      const mp_int *qinv, bool threads, mp_int *M)
+{
+   s_crt_half half[2];
+   mp_int m1, m2;
+   mp_err err;
+
+   if ((mp_cmp_d(p, 0uL) != MP_GT) || (mp_cmp_d(q, 0uL) != MP_GT)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&m1, &m2, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   half[0].G = C;
+   half[0].X = dp;
+   half[0].P = p;
+   half[0].Y = &m1;
+   half[1].G = C;
+   half[1].X = dq;
+   half[1].P = q;
+   half[1].Y = &m2;
+   if (threads && MP_HAS(S_MP_PARALLEL)) {
+      s_mp_parallel(s_crt_exptmod, half, sizeof(half[0]), 2, 2);
+   } else {
+      s_crt_exptmod(&half[0]);
+      s_crt_exptmod(&half[1]);
+   }
+   if ((err = half[0].err) != MP_OKAY)                                 goto LBL_ERR;
+   if ((err = half[1].err) != MP_OKAY)                                 goto LBL_ERR;
+
+   /* m1 = qinv * (m1 - m2) mod p, M = m2 + q * m1 */
+   if ((err = mp_sub(&m1, &m2, &m1)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_mulmod(&m1, qinv, p, &m1)) != MP_OKAY)                goto LBL_ERR;
+   if ((err = mp_mul(&m1, q, &m1)) != MP_OKAY)                         goto LBL_ERR;
+   if ((err = mp_add(&m1, &m2, M)) != MP_OKAY)                         goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear_multi(&m1, &m2, NULL);
+   return err;
+}
+#endif
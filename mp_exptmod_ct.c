@@ -0,0 +1,187 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_CT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P for odd P without branches or memory accesses
+ * that depend on the bits of X
+ *
+ * Uses a left-to-right fixed window, every window is a fixed number of
+ * squarings and one multiplication, also for zero windows.  The table is
+ * read completely for every lookup and the entry is selected with masks.
+ *
+ * The numbers are kept in P->used digits, one more if P is too close to
+ * that, such that R = B**n > 4P.  The Montgomery multiplication then maps
+ * values below 2P to values below 2P and needs no final subtraction, only
+ * the conversion of the result does a masked one.
+ *
+ * Only the number of digits of X is visible, not its value.
+ */
+
+#define MP_CT_LINE_DIGITS ((int)(64u / sizeof(mp_digit)))
+
+/* r = a * b / B**n mod m with a, b < 2m, result < 2m. r may alias a or b, t has n + 1 digits */
+static void s_ct_mul(const mp_digit *a, const mp_digit *b, const mp_digit *m, mp_digit rho, int n, mp_digit *t, mp_digit *r)
+{
+   int i, j;
+   mp_word c;
+   mp_digit mu;
+
+   s_mp_zero_digs(t, n + 1);
+   for (i = 0; i < n; i++) {
+      /* t = (t + a[i] * b + mu * m) / B */
+      c = (mp_word)t[0] + ((mp_word)a[i] * (mp_word)b[0]);
+      mu = ((mp_digit)c * rho) & MP_MASK;
+      c = (c + ((mp_word)mu * (mp_word)m[0])) >> (mp_word)MP_DIGIT_BIT;
+      for (j = 1; j < n; j++) {
+         c += (mp_word)t[j] + ((mp_word)a[i] * (mp_word)b[j]) + ((mp_word)mu * (mp_word)m[j]);
+         t[j - 1] = (mp_digit)(c & (mp_word)MP_MASK);
+         c >>= (mp_word)MP_DIGIT_BIT;
+      }
+      c += (mp_word)t[n];
+      t[n - 1] = (mp_digit)(c & (mp_word)MP_MASK);
+      t[n] = (mp_digit)(c >> (mp_word)MP_DIGIT_BIT);
+   }
+   s_mp_copy_digs(r, t, n);
+}
+
+/* r = tab[x], every entry of the table is read */
+static void s_ct_get(const mp_digit *tab, int entries, int stride, int n, unsigned int x, mp_digit *r)
+{
+   int i, j;
+   unsigned int d;
+   mp_digit mask;
+
+   s_mp_zero_digs(r, n);
+   for (i = 0; i < entries; i++) {
+      /* all ones if i == x */
+      d = (unsigned int)i ^ x;
+      mask = (mp_digit)((d | (0u - d)) >> (MP_SIZEOF_BITS(unsigned int) - 1u)) - 1u;
+      for (j = 0; j < n; j++) {
+         r[j] |= tab[(i * stride) + j] & mask;
+      }
+   }
+}
+
+/* r = a - m if a >= m, else a, with a <= m */
+static void s_ct_sub(mp_digit *a, const mp_digit *m, int n, mp_digit *t)
+{
+   int j;
+   mp_digit borrow = 0, mask;
+
+   for (j = 0; j < n; j++) {
+      t[j] = a[j] - m[j] - borrow;
+      borrow = t[j] >> (MP_SIZEOF_BITS(mp_digit) - 1u);
+      t[j] &= MP_MASK;
+   }
+   /* all ones if there was no borrow */
+   mask = borrow - 1u;
+   for (j = 0; j < n; j++) {
+      a[j] = (t[j] & mask) | (a[j] & ~mask);
+   }
+}
+
+/* copies the digits of a < B**n */
+static void s_ct_from_mp(const mp_int *a, mp_digit *r, int n)
+{
+   s_mp_copy_digs(r, a->dp, a->used);
+   s_mp_zero_digs(r + a->used, n - a->used);
+}
+
+mp_err mp_exptmod_ct(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y)
+{
+   mp_digit *buf, *base, *m, *res, *u, *t, *tab, rho;
+   int n, i, j, winsize, bits, stride, entries;
+   unsigned int x;
+   size_t size;
+   mp_int a;
+   mp_err err;
+
+   if (mp_isneg(P) || mp_iseven(P) || mp_isneg(X)) {
+      return MP_VAL;
+   }
+   if (mp_cmp_d(P, 1uL) == MP_EQ) {
+      mp_zero(Y);
+      return MP_OKAY;
+   }
+
+   /* digit count such that R = B**n > 4P */
+   n = P->used;
+   if (mp_count_bits(P) > ((n * MP_DIGIT_BIT) - 2)) {
+      n++;
+   }
+
+   /* all digits of X are processed */
+   bits = X->used * MP_DIGIT_BIT;
+   winsize = (bits <= 512) ? 4 : 5;
+   entries = 1 << winsize;
+   stride = ((n + MP_CT_LINE_DIGITS - 1) / MP_CT_LINE_DIGITS) * MP_CT_LINE_DIGITS;
+
+   /* modulus, result, temporaries and the table, aligned to 64 bytes */
+   size = (sizeof(mp_digit) * (((size_t)n * 4u) + 1u + ((size_t)stride * (size_t)entries))) + 64u;
+   buf = (mp_digit *) MP_MALLOC(size);
+   if (buf == NULL) {
+      return MP_MEM;
+   }
+   base = (mp_digit *)(void *)(((uintptr_t)buf + 63u) & ~(uintptr_t)63u);
+   tab = base;
+   m = tab + ((size_t)stride * (size_t)entries);
+   res = m + n;
+   u = res + n;
+   t = u + n;
+
+   if ((err = mp_init(&a)) != MP_OKAY) {
+      goto LBL_BUF;
+   }
+   if ((err = mp_montgomery_setup(P, &rho)) != MP_OKAY)              goto LBL_A;
+   s_ct_from_mp(P, m, n);
+
+   /* tab[0] = R mod P, tab[1] = G * R mod P by multiplying with R**2 mod P */
+   if ((err = mp_2expt(&a, 2 * n * MP_DIGIT_BIT)) != MP_OKAY)       goto LBL_A;
+   if ((err = mp_mod(&a, P, &a)) != MP_OKAY)                          goto LBL_A;
+   s_ct_from_mp(&a, u, n);
+   if ((err = mp_mod(G, P, &a)) != MP_OKAY)                           goto LBL_A;
+   s_ct_from_mp(&a, res, n);
+   s_ct_mul(res, u, m, rho, n, t, tab + stride);
+   s_mp_zero_digs(res, n);
+   res[0] = 1u;
+   s_ct_mul(res, u, m, rho, n, t, tab);
+   for (i = 2; i < entries; i++) {
+      s_ct_mul(tab + ((i - 1) * stride), tab + stride, m, rho, n, t, tab + (i * stride));
+   }
+
+   /* res = 1 in Montgomery form, then winsize squarings and one multiplication per window */
+   s_mp_copy_digs(res, tab, n);
+   for (i = ((bits + (winsize - 1)) / winsize) - 1; i >= 0; i--) {
+      x = 0u;
+      for (j = winsize - 1; j >= 0; j--) {
+         x = (x << 1) | (s_mp_get_bit(X, (i * winsize) + j) ? 1u : 0u);
+      }
+      for (j = 0; j < winsize; j++) {
+         s_ct_mul(res, res, m, rho, n, t, res);
+      }
+      s_ct_get(tab, entries, stride, n, x, u);
+      s_ct_mul(res, u, m, rho, n, t, res);
+   }
+
+   /* leave the Montgomery domain, the result is at most P */
+   s_mp_zero_digs(u, n);
+   u[0] = 1u;
+   s_ct_mul(res, u, m, rho, n, t, res);
+   s_ct_sub(res, m, n, t);
+
+   if ((err = mp_grow(&a, n)) != MP_OKAY)                             goto LBL_A;
+   s_mp_copy_digs(a.dp, res, n);
+   s_mp_zero_digs(a.dp + n, a.used - n);
+   a.used = n;
+   a.sign = MP_ZPOS;
+   mp_clamp(&a);
+   mp_exch(&a, Y);
+
+LBL_A:
+   mp_clear(&a);
+LBL_BUF:
+   MP_FREE_BUF(buf, size);
+   return err;
+}
+#endif
@@ -0,0 +1,107 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_D_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**e mod P for a single 32 bit exponent
+ *
+ * Exponents like 3 or 65537 need a handful of squarings, the window table
+ * of s_mp_exptmod_fast would cost about as much as the powering itself.
+ * This is a plain left-to-right square and multiply with the reduction
+ * mp_exptmod would pick, Montgomery for odd moduli of no special form and
+ * Barrett for the even ones.  mp_exptmod comes here for short exponents.
+ * A kernel for the host CPU still does all but the shortest of them.
+ */
+
+/* Barrett if redux is NULL */
+static mp_err s_reduce(mp_int *a, const mp_int *P, const mp_int *mu, mp_redux_fn redux, mp_digit rho)
+{
+   return (redux == NULL) ? mp_reduce(a, P, mu) : redux(a, P, rho);
+}
+
+mp_err mp_exptmod_d(const mp_int *G, uint32_t e, const mp_int *P, mp_int *Y)
+{
+   mp_int x, res, mu;
+   mp_redux_fn redux = NULL;
+   const mp_kernel_table *kernels = s_mp_kernels();
+   mp_digit rho = 0;
+   int i, redmode;
+   mp_err err;
+
+   /* modulus P must be positive */
+   if (mp_isneg(P)) {
+      return MP_VAL;
+   }
+
+   /* the special forms need no conversion of G, -1 for Barrett */
+   if (MP_HAS(MP_REDUCE_IS_SPECIAL) && mp_reduce_is_special(P)) {
+      redmode = 3;
+   } else if (MP_HAS(MP_DR_IS_MODULUS) && mp_dr_is_modulus(P)) {
+      redmode = 1;
+   } else if (MP_HAS(MP_REDUCE_IS_2K) && mp_reduce_is_2k(P)) {
+      redmode = 2;
+   } else {
+      redmode = mp_isodd(P) ? 0 : -1;
+   }
+
+   if ((err = mp_init_multi(&x, &res, &mu, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* from a few bits on the kernel for the host CPU, if any, is faster */
+   if ((redmode == 0) && (kernels->exptmod != NULL) && ((e >> MP_EXPTMOD_SHORT_KERNEL_BITS) != 0u) &&
+       (mp_count_bits(P) >= kernels->exptmod_min_bits) && (mp_count_bits(P) <= kernels->exptmod_max_bits)) {
+      mp_set_u32(&mu, e);
+      err = kernels->exptmod(G, &mu, P, Y);
+      goto LBL_ERR;
+   }
+
+   /* G**0 == 1 */
+   if (e == 0u) {
+      mp_set(&res, 1uL);
+      if ((err = mp_mod(&res, P, &res)) != MP_OKAY)                   goto LBL_ERR;
+      mp_exch(&res, Y);
+      goto LBL_ERR;
+   }
+
+   if (redmode < 0) {
+      if (!MP_HAS(MP_REDUCE_SETUP) || !MP_HAS(MP_REDUCE)) {
+         err = MP_VAL;
+         goto LBL_ERR;
+      }
+      if ((err = mp_reduce_setup(&mu, P)) != MP_OKAY)                 goto LBL_ERR;
+   } else {
+      if ((err = s_mp_exptmod_setup(P, redmode, &redux, &rho)) != MP_OKAY) goto LBL_ERR;
+   }
+
+   /* x = G mod P, for Montgomery times R = B**n */
+   if (redmode == 0) {
+      if ((err = mp_mul_2d(G, P->used * MP_DIGIT_BIT, &x)) != MP_OKAY) goto LBL_ERR;
+      if ((err = mp_mod(&x, P, &x)) != MP_OKAY)                       goto LBL_ERR;
+   } else {
+      if ((err = mp_mod(G, P, &x)) != MP_OKAY)                        goto LBL_ERR;
+   }
+
+   /* left-to-right from below the leading one */
+   if ((err = mp_copy(&x, &res)) != MP_OKAY)                          goto LBL_ERR;
+   for (i = 31; ((e >> i) & 1u) == 0u; i--) {}
+   for (i = i - 1; i >= 0; i--) {
+      if ((err = mp_sqr(&res, &res)) != MP_OKAY)                      goto LBL_ERR;
+      if ((err = s_reduce(&res, P, &mu, redux, rho)) != MP_OKAY)      goto LBL_ERR;
+      if (((e >> i) & 1u) != 0u) {
+         if ((err = mp_mul(&res, &x, &res)) != MP_OKAY)               goto LBL_ERR;
+         if ((err = s_reduce(&res, P, &mu, redux, rho)) != MP_OKAY)   goto LBL_ERR;
+      }
+   }
+
+   /* leave the Montgomery domain */
+   if (redmode == 0) {
+      if ((err = redux(&res, P, rho)) != MP_OKAY)                     goto LBL_ERR;
+   }
+   mp_exch(&res, Y);
+
+LBL_ERR:
+   mp_clear_multi(&x, &res, &mu, NULL);
+   return err;
+}
+#endif
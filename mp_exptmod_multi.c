@@ -0,0 +1,221 @@
+#include "tommath_private.h"
+#ifdef MP_EXPTMOD_MULTI_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G[0]**X[0] * G[1]**X[1] * ... * G[n-1]**X[n-1] mod P
+ *
+ * Interleaved sliding windows, every base has its own table of odd powers
+ * and its own windows, all of them share one chain of squarings.
+ *
+ *    Moeller, Bodo. "Algorithms for Multi-exponentiation." Selected Areas
+ *    in Cryptography (SAC 2001). Springer, 2001.
+ *
+ * Uses the reduction s_mp_exptmod_fast would use for P, other moduli
+ * and moduli a host exptmod kernel handles get one mp_exptmod per base.
+ */
+
+/* from this size on a host exptmod kernel is about twice as fast as the
+ * portable code, one kernel call per base is then cheaper
+ */
+#define MP_EXPTMOD_MULTI_KERNEL_BITS 1536
+
+#ifdef MP_LOW_MEM
+#   define MAX_WINSIZE 5
+#else
+#   define MAX_WINSIZE 8
+#endif
+
+typedef struct {
+   mp_int *M;           /* M[i] = G**(2i+1) in the domain of the reduction */
+   int winsize,
+       pos,             /* the next window ends at bit pos, -1 if there is none */
+       val;             /* and has the odd value val */
+} s_mp_multi_base;
+
+/* finds the highest window of X at or below bit top */
+static void s_next_window(const mp_int *X, int top, s_mp_multi_base *b)
+{
+   int k;
+
+   while ((top >= 0) && !s_mp_get_bit(X, top)) {
+      top--;
+   }
+   if (top < 0) {
+      b->pos = -1;
+      return;
+   }
+   b->pos = MP_MAX(top - b->winsize + 1, 0);
+   while (!s_mp_get_bit(X, b->pos)) {
+      b->pos++;
+   }
+   b->val = 0;
+   for (k = top; k >= b->pos; k--) {
+      b->val = (b->val << 1) | (s_mp_get_bit(X, k) ? 1 : 0);
+   }
+}
+
+static mp_err s_exptmod_multi_slow(const mp_int *const G[], const mp_int *const X[], int n, const mp_int *P, mp_int *Y)
+{
+   mp_int res, t;
+   mp_err err;
+   int i;
+
+   if ((err = mp_init_multi(&res, &t, NULL)) != MP_OKAY) {
+      return err;
+   }
+   mp_set(&res, 1uL);
+   if ((err = mp_mod(&res, P, &res)) != MP_OKAY)                     goto LBL_ERR;
+   for (i = 0; i < n; i++) {
+      if ((err = mp_exptmod(G[i], X[i], P, &t)) != MP_OKAY)          goto LBL_ERR;
+      if ((err = mp_mulmod(&res, &t, P, &res)) != MP_OKAY)           goto LBL_ERR;
+   }
+   mp_exch(&res, Y);
+
+LBL_ERR:
+   mp_clear_multi(&res, &t, NULL);
+   return err;
+}
+
+mp_err mp_exptmod_multi(const mp_int *const G[], const mp_int *const X[], int n, const mp_int *P, mp_int *Y)
+{
+   s_mp_multi_base *b;
+   mp_int  *M, res, norm, t;
+   mp_digit mp;
+   mp_redux_fn redux;
+   const mp_kernel_table *kernels = s_mp_kernels();
+   int     i, j, k, x, bits, tabsize, inited, redmode;
+   bool    first;
+   mp_err  err;
+
+   /* modulus P must be positive */
+   if ((n < 0) || mp_isneg(P)) {
+      return MP_VAL;
+   }
+
+   /* same choice as mp_exptmod */
+   redmode = (MP_HAS(MP_DR_IS_MODULUS) && mp_dr_is_modulus(P)) ? 1 : 0;
+   if (MP_HAS(MP_REDUCE_IS_2K) && (redmode == 0)) {
+      redmode = mp_reduce_is_2k(P) ? 2 : 0;
+   }
+   if ((n < 2) || !MP_HAS(S_MP_EXPTMOD_SETUP) || !(mp_isodd(P) || (redmode != 0))) {
+      return s_exptmod_multi_slow(G, X, n, P, Y);
+   }
+   x = mp_count_bits(P);
+   if ((redmode == 0) && (kernels->exptmod != NULL) && (x >= MP_EXPTMOD_MULTI_KERNEL_BITS) &&
+       (x >= kernels->exptmod_min_bits) && (x <= kernels->exptmod_max_bits)) {
+      return s_exptmod_multi_slow(G, X, n, P, Y);
+   }
+
+   b = (s_mp_multi_base *) MP_CALLOC((size_t)n, sizeof(*b));
+   if (b == NULL) {
+      return MP_MEM;
+   }
+
+   /* find window sizes, as in s_mp_exptmod_fast */
+   tabsize = 0;
+   bits = 0;
+   for (i = 0; i < n; i++) {
+      x = mp_count_bits(X[i]);
+      bits = MP_MAX(bits, x);
+      b[i].winsize = (x <= 7) ? 2 : ((x <= 36) ? 3 : ((x <= 140) ? 4 :
+                     ((x <= 450) ? 5 : ((x <= 1303) ? 6 : ((x <= 3529) ? 7 : 8)))));
+      b[i].winsize = MP_MIN(MAX_WINSIZE, b[i].winsize);
+      tabsize += 1 << (b[i].winsize - 1);
+   }
+
+   M = (mp_int *) MP_CALLOC((size_t)tabsize, sizeof(mp_int));
+   if (M == NULL) {
+      MP_FREE(b, (size_t)n * sizeof(*b));
+      return MP_MEM;
+   }
+   for (inited = 0; inited < tabsize; inited++) {
+      if ((err = mp_init_size(&M[inited], P->alloc)) != MP_OKAY)     goto LBL_M;
+   }
+   if ((err = mp_init_multi(&res, &norm, &t, NULL)) != MP_OKAY)      goto LBL_M;
+
+   if ((err = s_mp_exptmod_setup(P, redmode, &redux, &mp)) != MP_OKAY) goto LBL_RES;
+
+   /* res = 1 in the domain of the reduction */
+   if (redmode == 0) {
+      if (!MP_HAS(MP_MONTGOMERY_CALC_NORMALIZATION)) {
+         err = MP_VAL;
+         goto LBL_RES;
+      }
+      if ((err = mp_montgomery_calc_normalization(&norm, P)) != MP_OKAY) goto LBL_RES;
+      if ((err = mp_copy(&norm, &res)) != MP_OKAY)                   goto LBL_RES;
+   } else {
+      mp_set(&res, 1uL);
+   }
+
+   /* create the tables of odd powers, G**-1 for negative exponents */
+   k = 0;
+   for (i = 0; i < n; i++) {
+      b[i].M = &M[k];
+      k += 1 << (b[i].winsize - 1);
+
+      if (mp_isneg(X[i])) {
+         if (!MP_HAS(MP_INVMOD)) {
+            err = MP_VAL;
+            goto LBL_RES;
+         }
+         if ((err = mp_invmod(G[i], P, &b[i].M[0])) != MP_OKAY)     goto LBL_RES;
+      } else if ((err = mp_copy(G[i], &b[i].M[0])) != MP_OKAY)      goto LBL_RES;
+      if ((err = mp_mod(&b[i].M[0], P, &b[i].M[0])) != MP_OKAY)     goto LBL_RES;
+      if (redmode == 0) {
+         if ((err = mp_mulmod(&b[i].M[0], &norm, P, &b[i].M[0])) != MP_OKAY) goto LBL_RES;
+      }
+
+      if (b[i].winsize > 1) {
+         if ((err = mp_sqr(&b[i].M[0], &t)) != MP_OKAY)              goto LBL_RES;
+         if ((err = redux(&t, P, mp)) != MP_OKAY)                    goto LBL_RES;
+         for (x = 1; x < (1 << (b[i].winsize - 1)); x++) {
+            if ((err = mp_mul(&b[i].M[x - 1], &t, &b[i].M[x])) != MP_OKAY) goto LBL_RES;
+            if ((err = redux(&b[i].M[x], P, mp)) != MP_OKAY)        goto LBL_RES;
+         }
+      }
+
+      s_next_window(X[i], bits - 1, &b[i]);
+   }
+
+   /* one squaring per bit, each base multiplies in its windows where they end */
+   first = true;
+   for (j = bits - 1; j >= 0; j--) {
+      if (!first) {
+         if ((err = mp_sqr(&res, &res)) != MP_OKAY)                  goto LBL_RES;
+         if ((err = redux(&res, P, mp)) != MP_OKAY)                  goto LBL_RES;
+      }
+      for (i = 0; i < n; i++) {
+         if (b[i].pos != j) {
+            continue;
+         }
+         if (first) {
+            if ((err = mp_copy(&b[i].M[b[i].val >> 1], &res)) != MP_OKAY) goto LBL_RES;
+            first = false;
+         } else {
+            if ((err = mp_mul(&res, &b[i].M[b[i].val >> 1], &res)) != MP_OKAY) goto LBL_RES;
+            if ((err = redux(&res, P, mp)) != MP_OKAY)               goto LBL_RES;
+         }
+         s_next_window(X[i], j - 1, &b[i]);
+      }
+   }
+
+   if (redmode == 0) {
+      /* cancel out the factor of R */
+      if ((err = redux(&res, P, mp)) != MP_OKAY)                     goto LBL_RES;
+   }
+
+   mp_exch(&res, Y);
+   err = MP_OKAY;
+
+LBL_RES:
+   mp_clear_multi(&res, &norm, &t, NULL);
+LBL_M:
+   while (inited-- > 0) {
+      mp_clear(&M[inited]);
+   }
+   MP_FREE(M, (size_t)tabsize * sizeof(mp_int));
+   MP_FREE(b, (size_t)n * sizeof(*b));
+   return err;
+}
+#endif
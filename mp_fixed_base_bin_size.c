@@ -0,0 +1,12 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_BIN_SIZE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* the three 32 bit header fields, P and the table entries with as many bytes as P */
+size_t mp_fixed_base_bin_size(const mp_fixed_base *fb)
+{
+   size_t size = mp_ubin_size(&fb->ctx.N);
+   return 12u + (size * (((size_t)1 << fb->teeth) + 1u));
+}
+#endif
@@ -0,0 +1,12 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+void mp_fixed_base_clear(mp_fixed_base *fb)
+{
+   MP_FREE_DIGS(fb->tab, fb->width << fb->teeth);
+   fb->tab = NULL;
+   mp_mont_ctx_clear(&fb->ctx);
+}
+#endif
@@ -0,0 +1,76 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_EXPTMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P with the comb table of G, HAC pp.625, Algorithm 14.117
+ *
+ * Every one of the spacing steps takes one bit of each of the teeth blocks of X
+ * as index into the table, that is one squaring and at most one multiplication.
+ * Negative exponents and exponents larger than the table go through mp_exptmod.
+ */
+mp_err mp_fixed_base_exptmod(const mp_fixed_base *fb, const mp_int *X, mp_int *Y)
+{
+   mp_int res, t;
+   int    i, j, idx;
+   bool   first;
+   mp_err err;
+
+   if (mp_isneg(X) || (mp_count_bits(X) > (fb->teeth * fb->spacing))) {
+      if ((err = mp_init(&t)) != MP_OKAY) {
+         return err;
+      }
+      if ((err = s_mp_fixed_base_get(fb, 1, &t)) != MP_OKAY)           goto LBL_SLOW;
+      if ((err = mp_from_mont(&t, &fb->ctx, &t)) != MP_OKAY)           goto LBL_SLOW;
+      err = mp_exptmod(&t, X, &fb->ctx.N, Y);
+LBL_SLOW:
+      mp_clear(&t);
+      return err;
+   }
+
+   if ((err = mp_init_size(&res, 2 * fb->width)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_size(&t, 2 * fb->width)) != MP_OKAY) {
+      mp_clear(&res);
+      return err;
+   }
+
+   first = true;
+   for (i = fb->spacing - 1; i >= 0; i--) {
+      if (!first) {
+         if ((err = mp_mont_sqr(&res, &fb->ctx, &res)) != MP_OKAY)     goto LBL_ERR;
+      }
+
+      idx = 0;
+      for (j = fb->teeth - 1; j >= 0; j--) {
+         idx = (idx << 1) | (s_mp_get_bit(X, (j * fb->spacing) + i) ? 1 : 0);
+      }
+      if (idx == 0) {
+         continue;
+      }
+
+      if (first) {
+         if ((err = s_mp_fixed_base_get(fb, idx, &res)) != MP_OKAY)    goto LBL_ERR;
+         first = false;
+      } else {
+         if ((err = s_mp_fixed_base_get(fb, idx, &t)) != MP_OKAY)      goto LBL_ERR;
+         if ((err = mp_mont_mul(&res, &t, &fb->ctx, &res)) != MP_OKAY) goto LBL_ERR;
+      }
+   }
+
+   if (first) {
+      /* X = 0 */
+      mp_set(&res, 1uL);
+   } else if ((err = mp_from_mont(&res, &fb->ctx, &res)) != MP_OKAY) {
+      goto LBL_ERR;
+   }
+
+   mp_exch(&res, Y);
+
+LBL_ERR:
+   mp_clear(&t);
+   mp_clear(&res);
+   return err;
+}
+#endif
@@ -0,0 +1,72 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_FROM_BIN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* reads a 32 bit big endian number */
+static size_t s_get_u32(const uint8_t *buf)
+{
+   return ((size_t)buf[0] << 24) | ((size_t)buf[1] << 16) | ((size_t)buf[2] << 8) | (size_t)buf[3];
+}
+
+/* reads a table stored with mp_fixed_base_to_bin, the entries are brought back into Montgomery form */
+mp_err mp_fixed_base_from_bin(mp_fixed_base *fb, const uint8_t *buf, size_t size)
+{
+   size_t teeth, spacing, n;
+   const uint8_t *b;
+   mp_int t;
+   mp_err err;
+   int i;
+
+   if (size < 12u) {
+      return MP_VAL;
+   }
+   teeth = s_get_u32(buf);
+   spacing = s_get_u32(buf + 4);
+   n = s_get_u32(buf + 8);
+   if ((teeth < 1u) || (teeth > (size_t)MP_FIXED_BASE_MAX_TEETH) ||
+       (spacing < 1u) || (spacing > (size_t)(INT_MAX / 16)) || (n < 1u) ||
+       (((size - 12u) / (((size_t)1 << teeth) + 1u)) != n) ||
+       (((size - 12u) % (((size_t)1 << teeth) + 1u)) != 0u)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init(&t)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_from_ubin(&t, buf + 12, n)) != MP_OKAY)             goto LBL_T;
+   if ((err = mp_mont_ctx_init(&fb->ctx, &t)) != MP_OKAY)            goto LBL_T;
+
+   fb->teeth = (int)teeth;
+   fb->spacing = (int)spacing;
+   fb->width = fb->ctx.N.used;
+   fb->tab = (mp_digit *) MP_CALLOC((size_t)1 << fb->teeth, (size_t)fb->width * sizeof(mp_digit));
+   if (fb->tab == NULL) {
+      err = MP_MEM;
+      goto LBL_CTX;
+   }
+
+   b = buf + 12 + n;
+   for (i = 0; i < (1 << fb->teeth); i++) {
+      if ((err = mp_from_ubin(&t, b, n)) != MP_OKAY)                 goto LBL_TAB;
+      if (mp_cmp(&t, &fb->ctx.N) != MP_LT) {
+         err = MP_VAL;
+         goto LBL_TAB;
+      }
+      if ((err = mp_to_mont(&t, &fb->ctx, &t)) != MP_OKAY)           goto LBL_TAB;
+      s_mp_fixed_base_set(fb, i, &t);
+      b += n;
+   }
+
+   mp_clear(&t);
+   return MP_OKAY;
+
+LBL_TAB:
+   MP_FREE_DIGS(fb->tab, fb->width << fb->teeth);
+LBL_CTX:
+   mp_mont_ctx_clear(&fb->ctx);
+LBL_T:
+   mp_clear(&t);
+   return err;
+}
+#endif
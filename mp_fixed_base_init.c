@@ -0,0 +1,68 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* Lim-Lee comb table, for teeth t and spacing d the entry
+ * i = i[t-1]...i[1]i[0] (binary) holds G**(i[t-1]*2**((t-1)*d) + ... + i[0]*2**0)
+ */
+
+mp_err mp_fixed_base_init(mp_fixed_base *fb, const mp_int *G, const mp_int *P, int bits)
+{
+   mp_int t, u;
+   int    i, j, k;
+   mp_err err;
+
+   if (bits < 1) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_mont_ctx_init(&fb->ctx, P)) != MP_OKAY) {
+      return err;
+   }
+
+   fb->teeth = (bits <= 128) ? 4 : ((bits <= 512) ? 6 : 8);
+   fb->teeth = MP_MIN(fb->teeth, MP_FIXED_BASE_MAX_TEETH);
+   fb->spacing = (bits + fb->teeth - 1) / fb->teeth;
+   fb->width = fb->ctx.N.used;
+   fb->tab = (mp_digit *) MP_CALLOC((size_t)1 << fb->teeth, (size_t)fb->width * sizeof(mp_digit));
+   if (fb->tab == NULL) {
+      err = MP_MEM;
+      goto LBL_CTX;
+   }
+
+   if ((err = mp_init_size(&t, 2 * fb->width)) != MP_OKAY)           goto LBL_TAB;
+   if ((err = mp_init_size(&u, 2 * fb->width)) != MP_OKAY)           goto LBL_T;
+
+   /* entry 0 is 1 and entry 2**j is G**(2**(j*d)), the others are products of those */
+   s_mp_fixed_base_set(fb, 0, &fb->ctx.R);
+   if ((err = mp_to_mont(G, &fb->ctx, &t)) != MP_OKAY)                goto LBL_U;
+   for (j = 0; j < fb->teeth; j++) {
+      if (j > 0) {
+         for (k = 0; k < fb->spacing; k++) {
+            if ((err = mp_mont_sqr(&t, &fb->ctx, &t)) != MP_OKAY)     goto LBL_U;
+         }
+      }
+      s_mp_fixed_base_set(fb, 1 << j, &t);
+      for (i = 1; i < (1 << j); i++) {
+         if ((err = s_mp_fixed_base_get(fb, i, &u)) != MP_OKAY)       goto LBL_U;
+         if ((err = mp_mont_mul(&u, &t, &fb->ctx, &u)) != MP_OKAY)    goto LBL_U;
+         s_mp_fixed_base_set(fb, (1 << j) + i, &u);
+      }
+   }
+
+   mp_clear(&u);
+   mp_clear(&t);
+   return MP_OKAY;
+
+LBL_U:
+   mp_clear(&u);
+LBL_T:
+   mp_clear(&t);
+LBL_TAB:
+   MP_FREE_DIGS(fb->tab, fb->width << fb->teeth);
+LBL_CTX:
+   mp_mont_ctx_clear(&fb->ctx);
+   return err;
+}
+#endif
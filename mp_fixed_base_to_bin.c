@@ -0,0 +1,60 @@
+#include "tommath_private.h"
+#ifdef MP_FIXED_BASE_TO_BIN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* stores a 32 bit big endian number */
+static void s_put_u32(uint8_t *buf, size_t v)
+{
+   int i;
+   for (i = 3; i >= 0; i--) {
+      buf[i] = (uint8_t)(v & 255u);
+      v >>= 8;
+   }
+}
+
+/* stores teeth, spacing and the size of P in bytes as 32 bit big endian numbers,
+ * then P and the table entries zero padded to the size of P.  The entries are stored
+ * as plain residues, not in Montgomery form, since R depends on MP_DIGIT_BIT.
+ */
+mp_err mp_fixed_base_to_bin(const mp_fixed_base *fb, uint8_t *buf, size_t maxlen, size_t *written)
+{
+   size_t size = mp_ubin_size(&fb->ctx.N), count = mp_fixed_base_bin_size(fb), n;
+   uint8_t *b;
+   mp_int t;
+   mp_err err;
+   int i;
+
+   if (count > maxlen) {
+      return MP_BUF;
+   }
+
+   s_put_u32(buf, (size_t)fb->teeth);
+   s_put_u32(buf + 4, (size_t)fb->spacing);
+   s_put_u32(buf + 8, size);
+   if ((err = mp_to_ubin(&fb->ctx.N, buf + 12, size, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_init_size(&t, fb->width)) != MP_OKAY) {
+      return err;
+   }
+   b = buf + 12 + size;
+   for (i = 0; i < (1 << fb->teeth); i++) {
+      if ((err = s_mp_fixed_base_get(fb, i, &t)) != MP_OKAY)          goto LBL_ERR;
+      if ((err = mp_from_mont(&t, &fb->ctx, &t)) != MP_OKAY)          goto LBL_ERR;
+      n = mp_ubin_size(&t);
+      s_mp_zero_buf(b, size - n);
+      if ((err = mp_to_ubin(&t, b + (size - n), n, NULL)) != MP_OKAY) goto LBL_ERR;
+      b += size;
+   }
+
+   if (written != NULL) {
+      *written = count;
+   }
+
+LBL_ERR:
+   mp_clear(&t);
+   return err;
+}
+#endif
@@ -0,0 +1,15 @@
+#include "tommath_private.h"
+#ifdef MP_FROM_MONT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+mp_err mp_from_mont(const mp_int *a, const mp_mont_ctx *ctx, mp_int *c)
+{
+   mp_err err;
+
+   if ((err = mp_copy(a, c)) != MP_OKAY) {
+      return err;
+   }
+   return mp_montgomery_reduce(c, &ctx->N, ctx->rho);
+}
+#endif
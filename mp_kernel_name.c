@@ -0,0 +1,13 @@
+#include "tommath_private.h"
+#ifdef MP_KERNEL_NAME_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+const char *mp_kernel_name(mp_kernel kernel)
+{
+   if ((kernel < MP_KERNEL_EXPTMOD) || (kernel > MP_KERNEL_EXPTMOD4)) {
+      return NULL;
+   }
+   return s_mp_kernels()->name[kernel];
+}
+#endif
@@ -19,16 +19,16 @@ mp_err mp_lcm(const mp_int *a, const mp_int *b, mp_int *c)
       goto LBL_T;
    }
 
-   /* divide the smallest by the GCD */
+   /* divide the smallest by the GCD, it divides evenly */
    if (mp_cmp_mag(a, b) == MP_LT) {
       /* store quotient in t2 such that t2 * b is the LCM */
-      if ((err = mp_div(a, &t1, &t2, NULL)) != MP_OKAY) {
+      if ((err = mp_divexact(a, &t1, &t2)) != MP_OKAY) {
          goto LBL_T;
       }
       err = mp_mul(b, &t2, c);
    } else {
       /* store quotient in t2 such that t2 * a is the LCM */
-      if ((err = mp_div(b, &t1, &t2, NULL)) != MP_OKAY) {
+      if ((err = mp_divexact(b, &t1, &t2)) != MP_OKAY) {
          goto LBL_T;
       }
       err = mp_mul(a, &t2, c);
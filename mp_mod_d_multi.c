@@ -0,0 +1,92 @@
+#include "tommath_private.h"
+#ifdef MP_MOD_D_MULTI_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c[i] = |a| mod b[i] for i < n, as mp_mod_d for each of them
+ *
+ * Consecutive divisors are packed into products below beta / 4, the
+ * remainders by those come from one pass over the digits of a for up to
+ * MP_MOD_D_MULTI_PACKS of them at a time and are split into the ones by the
+ * divisors with a division of single digits each.  Every pack folds two
+ * digits of a at a time as s_mp_div_d_recip does without the quotient, the
+ * packs do not depend on each other.  Divisors of beta / 4 and more go
+ * through mp_mod_d.
+ */
+
+#define MP_MOD_D_MULTI_PACKS 32
+
+mp_err mp_mod_d_multi(const mp_int *a, const mp_digit *b, int n, mp_digit *c)
+{
+   mp_digit p[MP_MOD_D_MULTI_PACKS], b1[MP_MOD_D_MULTI_PACKS], b2[MP_MOD_D_MULTI_PACKS],
+            b3[MP_MOD_D_MULTI_PACKS], r1[MP_MOD_D_MULTI_PACKS], r0[MP_MOD_D_MULTI_PACKS];
+   int      start[MP_MOD_D_MULTI_PACKS], end[MP_MOD_D_MULTI_PACKS];
+   mp_digit u1, u0, r;
+   mp_word  t;
+   mp_err   err;
+   int      i, j, k, np, ix;
+
+   for (i = 0; i < n; i++) {
+      if (b[i] == 0u) {
+         return MP_VAL;
+      }
+   }
+
+   for (i = 0; i < n;) {
+      /* the next packs, the product of each below beta / 4 */
+      for (np = 0; (np < MP_MOD_D_MULTI_PACKS) && (i < n);) {
+         if (b[i] > (MP_MASK >> 2)) {
+            if ((err = mp_mod_d(a, b[i], &c[i])) != MP_OKAY) {
+               return err;
+            }
+            i++;
+            continue;
+         }
+         start[np] = i;
+         p[np] = b[i++];
+         while ((i < n) && (b[i] <= ((MP_MASK >> 2) / p[np]))) {
+            p[np] *= b[i++];
+         }
+         end[np++] = i;
+      }
+
+      for (k = 0; k < np; k++) {
+         b1[k] = (mp_digit)(((mp_word)1 << MP_DIGIT_BIT) % p[k]);
+         b2[k] = (mp_digit)(((mp_word)b1[k] * b1[k]) % p[k]);
+         b3[k] = (mp_digit)(((mp_word)b1[k] * b2[k]) % p[k]);
+         r1[k] = 0u;
+         r0[k] = 0u;
+      }
+
+      /* one pass over a, two digits at a time */
+      ix = a->used;
+      if ((ix & 1) == 1) {
+         ix--;
+         for (k = 0; k < np; k++) {
+            r0[k] = a->dp[ix];
+         }
+      }
+      while (ix > 0) {
+         ix -= 2;
+         u1 = a->dp[ix + 1];
+         u0 = a->dp[ix];
+         for (k = 0; k < np; k++) {
+            t  = ((mp_word)r0[k] * b2[k]) + ((mp_word)r1[k] * b3[k]);
+            t += ((mp_word)u1 * b1[k]) + (mp_word)u0;
+            r1[k] = (mp_digit)(t >> MP_DIGIT_BIT);
+            r0[k] = (mp_digit)(t & MP_MASK);
+         }
+      }
+
+      /* the remainders by the packs, then by their divisors */
+      for (k = 0; k < np; k++) {
+         r = (mp_digit)((((mp_word)r1[k] << MP_DIGIT_BIT) | (mp_word)r0[k]) % p[k]);
+         for (j = start[k]; j < end[k]; j++) {
+            c[j] = r % b[j];
+         }
+      }
+   }
+
+   return MP_OKAY;
+}
+#endif
@@ -0,0 +1,28 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_CTX_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+mp_err mp_mont_ctx_init(mp_mont_ctx *ctx, const mp_int *N)
+{
+   mp_err err;
+
+   if (mp_isneg(N) || mp_iseven(N) || (mp_cmp_d(N, 1u) != MP_GT)) {
+      return MP_VAL;
+   }
+
+   if ((err = mp_init_multi(&ctx->N, &ctx->R, &ctx->RR, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = mp_copy(N, &ctx->N)) != MP_OKAY)                                 goto LBL_ERR;
+   if ((err = mp_montgomery_setup(N, &ctx->rho)) != MP_OKAY)                   goto LBL_ERR;
+   if ((err = mp_montgomery_calc_normalization(&ctx->R, N)) != MP_OKAY)        goto LBL_ERR;
+   if ((err = mp_mulmod(&ctx->R, &ctx->R, N, &ctx->RR)) != MP_OKAY)            goto LBL_ERR;
+   return MP_OKAY;
+
+LBL_ERR:
+   mp_clear_multi(&ctx->N, &ctx->R, &ctx->RR, NULL);
+   return err;
+}
+#endif
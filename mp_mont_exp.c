@@ -0,0 +1,105 @@
+#include "tommath_private.h"
+#ifdef MP_MONT_EXP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* the table holds the odd powers a, a**3, ..., a**(2**winsize - 1) */
+#define MP_MONT_EXP_MAX_WINSIZE 6
+
+/* left-to-right sliding window exponentiation in Montgomery form */
+mp_err mp_mont_exp(const mp_int *a, const mp_int *e, const mp_mont_ctx *ctx, mp_int *c)
+{
+   mp_int M[1 << (MP_MONT_EXP_MAX_WINSIZE - 1)], res;
+   int i, j, k, x, bits, winsize, tabsize;
+   bool first;
+   const mp_kernel_table *kernels = s_mp_kernels();
+   mp_err err;
+
+   if (mp_isneg(e)) {
+      return MP_VAL;
+   }
+
+   bits = mp_count_bits(e);
+   if (bits == 0) {
+      return mp_copy(&ctx->R, c);
+   }
+
+   /* a special kernel for the host CPU does its own conversions, two more are cheap */
+   if ((kernels->exptmod != NULL) &&
+       (mp_count_bits(&ctx->N) >= kernels->exptmod_min_bits) &&
+       (mp_count_bits(&ctx->N) <= kernels->exptmod_max_bits)) {
+      if ((err = mp_init(&res)) != MP_OKAY) {
+         return err;
+      }
+      if ((err = mp_from_mont(a, ctx, &res)) != MP_OKAY)              goto LBL_RES;
+      if ((err = kernels->exptmod(&res, e, &ctx->N, &res)) != MP_OKAY) goto LBL_RES;
+      err = mp_to_mont(&res, ctx, c);
+LBL_RES:
+      mp_clear(&res);
+      return err;
+   }
+
+   winsize = (bits <= 7) ? 2 : ((bits <= 36) ? 3 : ((bits <= 140) ? 4 : ((bits <= 450) ? 5 : 6)));
+   tabsize = 1 << (winsize - 1);
+
+   if ((err = mp_init(&res)) != MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < tabsize; i++) {
+      if ((err = mp_init_size(&M[i], ctx->N.used * 2)) != MP_OKAY) {
+         while (i-- > 0) {
+            mp_clear(&M[i]);
+         }
+         mp_clear(&res);
+         return err;
+      }
+   }
+
+   /* M[i] = a**(2i+1) */
+   if ((err = mp_copy(a, &M[0])) != MP_OKAY)                           goto LBL_ERR;
+   if ((err = mp_mont_sqr(a, ctx, &res)) != MP_OKAY)                   goto LBL_ERR;
+   for (i = 1; i < tabsize; i++) {
+      if ((err = mp_mont_mul(&M[i - 1], &res, ctx, &M[i])) != MP_OKAY) goto LBL_ERR;
+   }
+
+   first = true;
+   i = bits - 1;
+   while (i >= 0) {
+      if (!s_mp_get_bit(e, i)) {
+         if ((err = mp_mont_sqr(&res, ctx, &res)) != MP_OKAY)          goto LBL_ERR;
+         i--;
+         continue;
+      }
+
+      /* the window e[i..j] ends with a set bit */
+      j = MP_MAX(i - winsize + 1, 0);
+      while (!s_mp_get_bit(e, j)) {
+         j++;
+      }
+      x = 0;
+      for (k = i; k >= j; k--) {
+         x = (x << 1) | (s_mp_get_bit(e, k) ? 1 : 0);
+      }
+
+      if (first) {
+         if ((err = mp_copy(&M[x >> 1], &res)) != MP_OKAY)             goto LBL_ERR;
+         first = false;
+      } else {
+         for (k = i; k >= j; k--) {
+            if ((err = mp_mont_sqr(&res, ctx, &res)) != MP_OKAY)       goto LBL_ERR;
+         }
+         if ((err = mp_mont_mul(&res, &M[x >> 1], ctx, &res)) != MP_OKAY) goto LBL_ERR;
+      }
+      i = j - 1;
+   }
+
+   mp_exch(&res, c);
+
+LBL_ERR:
+   for (i = 0; i < tabsize; i++) {
+      mp_clear(&M[i]);
+   }
+   mp_clear(&res);
+   return err;
+}
+#endif
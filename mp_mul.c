@@ -13,8 +13,17 @@ mp_err mp_mul(const mp_int *a, const mp_int *b, mp_int *c)
    bool neg = (a->sign != b->sign);
 
    if ((a == b) &&
-       MP_HAS(S_MP_SQR_TOOM) && /* use Toom-Cook? */
-       (a->used >= MP_SQR_TOOM_CUTOFF)) {
+       MP_HAS(S_MP_SQR_FFT) && /* use the NTT? */
+       (a->used >= MP_SQR_FFT_CUTOFF) &&
+       (digs <= MP_FFT_MAX_DIGITS)) {
+      err = s_mp_sqr_fft(a, c);
+   } else if ((a == b) &&
+              MP_HAS(S_MP_SQR_TOOM4) && /* use Toom-Cook 4-way? */
+              (a->used >= MP_SQR_TOOM4_CUTOFF)) {
+      err = s_mp_sqr_toom4(a, c);
+   } else if ((a == b) &&
+              MP_HAS(S_MP_SQR_TOOM) && /* use Toom-Cook? */
+              (a->used >= MP_SQR_TOOM_CUTOFF)) {
       err = s_mp_sqr_toom(a, c);
    } else if ((a == b) &&
               MP_HAS(S_MP_SQR_KARATSUBA) &&  /* Karatsuba? */
@@ -28,6 +37,11 @@ mp_err mp_mul(const mp_int *a, const mp_int *b, mp_int *c)
    } else if ((a == b) &&
               MP_HAS(S_MP_SQR)) {
       err = s_mp_sqr(a, c);
+   } else if (MP_HAS(S_MP_MUL_FFT) &&
+              /* The NTT does not care much about unbalanced inputs */
+              (min >= MP_MUL_FFT_CUTOFF) &&
+              (digs <= MP_FFT_MAX_DIGITS)) {
+      err = s_mp_mul_fft(a, b, c);
    } else if (MP_HAS(S_MP_MUL_BALANCE) &&
               /* Check sizes. The smaller one needs to be larger than the Karatsuba cut-off.
                * The bigger one needs to be at least about one MP_MUL_KARATSUBA_CUTOFF bigger
@@ -41,6 +55,19 @@ mp_err mp_mul(const mp_int *a, const mp_int *b, mp_int *c)
               /* Not much effect was observed below a ratio of 1:2, but again: YMMV. */
               (max >= (2 * min))) {
       err = s_mp_mul_balance(a,b,c);
+   } else if (MP_HAS(S_MP_MUL_TOOM32) &&
+              /* Ratio of about 3:2, the parts are half of the smaller input. */
+              ((min / 2) >= MP_MUL_KARATSUBA_CUTOFF) &&
+              ((5 * max) >= (7 * min))) {
+      err = s_mp_mul_toom32(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM43) &&
+              /* Ratio of about 4:3, the parts are a third of the smaller input. */
+              ((min / 3) >= MP_MUL_KARATSUBA_CUTOFF) &&
+              ((5 * max) >= (6 * min))) {
+      err = s_mp_mul_toom43(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_TOOM4) &&
+              (min >= MP_MUL_TOOM4_CUTOFF)) {
+      err = s_mp_mul_toom4(a, b, c);
    } else if (MP_HAS(S_MP_MUL_TOOM) &&
               (min >= MP_MUL_TOOM_CUTOFF)) {
       err = s_mp_mul_toom(a, b, c);
@@ -0,0 +1,30 @@
+#include "tommath_private.h"
+#ifdef MP_MUL_LOW_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a * b mod B**n, the n low digits of the product with its sign */
+mp_err mp_mul_low(const mp_int *a, const mp_int *b, int n, mp_int *c)
+{
+   mp_err err;
+   bool neg = (a->sign != b->sign);
+
+   if (n < 0) {
+      return MP_VAL;
+   }
+
+   if ((a->used + b->used) <= n) {
+      /* nothing to leave out */
+      return mp_mul(a, b, c);
+   } else if (MP_HAS(S_MP_MUL_MULDERS) &&
+              /* the low half of comba is faster as long as there is one */
+              ((n >= MP_WARRAY) || (MP_MIN(a->used, b->used) >= MP_MAX_COMBA)) &&
+              (MP_MIN(a->used, b->used) >= MP_MUL_KARATSUBA_CUTOFF)) {
+      err = s_mp_mul_mulders(a, b, c, n);
+   } else {
+      err = s_mp_mul(a, b, c, n);
+   }
+   c->sign = ((c->used > 0) && neg) ? MP_NEG : MP_ZPOS;
+   return err;
+}
+#endif
@@ -6,10 +6,13 @@
 /* d = a * b (mod c) */
 mp_err mp_mulmod(const mp_int *a, const mp_int *b, const mp_int *c, mp_int *d)
 {
+   mp_digit k;
    mp_err err;
+   bool special = MP_HAS(MP_REDUCE_SPECIAL_SETUP) && MP_HAS(MP_REDUCE_SPECIAL) &&
+                  (mp_reduce_special_setup(c, &k) == MP_OKAY);
    if ((err = mp_mul(a, b, d)) != MP_OKAY) {
       return err;
    }
-   return mp_mod(d, c, d);
+   return special ? mp_reduce_special(d, c, k) : mp_mod(d, c, d);
 }
 #endif
@@ -12,80 +12,89 @@
  */
 mp_err mp_prime_miller_rabin(const mp_int *a, const mp_int *b, bool *result)
 {
-   mp_int  n1, y, r;
+   mp_int  n1, y, r, one, m1;
+   mp_mont_ctx ctx;
    mp_err  err;
    int     s, j;
+   bool    mont;
 
    /* ensure b > 1 */
    if (mp_cmp_d(b, 1uL) != MP_GT) {
       return MP_VAL;
    }
 
-   /* get n1 = a - 1 */
-   if ((err = mp_init_copy(&n1, a)) != MP_OKAY) {
+   if ((err = mp_init_multi(&n1, &y, &r, &one, &m1, NULL)) != MP_OKAY) {
       return err;
    }
-   if ((err = mp_sub_d(&n1, 1uL, &n1)) != MP_OKAY) {
-      goto LBL_ERR1;
+
+   /* get n1 = a - 1 */
+   if ((err = mp_sub_d(a, 1uL, &n1)) != MP_OKAY) {
+      goto LBL_ERR;
    }
 
    /* set 2**s * r = n1 */
-   if ((err = mp_init_copy(&r, &n1)) != MP_OKAY) {
-      goto LBL_ERR1;
+   s = mp_cnt_lsb(&n1);
+   if ((err = mp_div_2d(&n1, s, &r, NULL)) != MP_OKAY) {
+      goto LBL_ERR;
    }
 
-   /* count the number of least significant bits
-    * which are zero
+   /* An odd a is handled in Montgomery form with one context for the
+    * exponentiation and all of the squarings, 1 and -1 become R and a - R.
     */
-   s = mp_cnt_lsb(&r);
+   mont = MP_HAS(MP_MONT_CTX_INIT) && mp_isodd(a) && (mp_cmp_d(a, 1uL) == MP_GT);
+   if (mont) {
+      if ((err = mp_mont_ctx_init(&ctx, a)) != MP_OKAY) {
+         goto LBL_ERR;
+      }
+      if ((err = mp_copy(&ctx.R, &one)) != MP_OKAY)                     goto LBL_CTX;
+      if ((err = mp_sub(a, &ctx.R, &m1)) != MP_OKAY)                    goto LBL_CTX;
 
-   /* now divide n - 1 by 2**s */
-   if ((err = mp_div_2d(&r, s, &r, NULL)) != MP_OKAY) {
-      goto LBL_ERR2;
-   }
+      /* compute y = b**r mod a */
+      if ((err = mp_to_mont(b, &ctx, &y)) != MP_OKAY)                   goto LBL_CTX;
+      if ((err = mp_mont_exp(&y, &r, &ctx, &y)) != MP_OKAY)             goto LBL_CTX;
+   } else {
+      mp_set(&one, 1uL);
+      if ((err = mp_copy(&n1, &m1)) != MP_OKAY)                         goto LBL_ERR;
 
-   /* compute y = b**r mod a */
-   if ((err = mp_init(&y)) != MP_OKAY) {
-      goto LBL_ERR2;
-   }
-   if ((err = mp_exptmod(b, &r, a, &y)) != MP_OKAY) {
-      goto LBL_END;
+      /* compute y = b**r mod a */
+      if ((err = mp_exptmod(b, &r, a, &y)) != MP_OKAY)                  goto LBL_ERR;
    }
 
    /* if y != 1 and y != n1 do */
-   if ((mp_cmp_d(&y, 1uL) != MP_EQ) && (mp_cmp(&y, &n1) != MP_EQ)) {
+   if ((mp_cmp(&y, &one) != MP_EQ) && (mp_cmp(&y, &m1) != MP_EQ)) {
       j = 1;
       /* while j <= s-1 and y != n1 */
-      while ((j <= (s - 1)) && (mp_cmp(&y, &n1) != MP_EQ)) {
-         if ((err = mp_sqrmod(&y, a, &y)) != MP_OKAY) {
-            goto LBL_END;
+      while ((j <= (s - 1)) && (mp_cmp(&y, &m1) != MP_EQ)) {
+         err = mont ? mp_mont_sqr(&y, &ctx, &y) : mp_sqrmod(&y, a, &y);
+         if (err != MP_OKAY) {
+            goto LBL_CTX;
          }
 
          /* if y == 1 then composite */
-         if (mp_cmp_d(&y, 1uL) == MP_EQ) {
+         if (mp_cmp(&y, &one) == MP_EQ) {
             *result = false;
-            goto LBL_END;
+            goto LBL_CTX;
          }
 
          ++j;
       }
 
       /* if y != n1 then composite */
-      if (mp_cmp(&y, &n1) != MP_EQ) {
+      if (mp_cmp(&y, &m1) != MP_EQ) {
          *result = false;
-         goto LBL_END;
+         goto LBL_CTX;
       }
    }
 
    /* probably prime now */
    *result = true;
 
-LBL_END:
-   mp_clear(&y);
-LBL_ERR2:
-   mp_clear(&r);
-LBL_ERR1:
-   mp_clear(&n1);
+LBL_CTX:
+   if (mont) {
+      mp_mont_ctx_clear(&ctx);
+   }
+LBL_ERR:
+   mp_clear_multi(&n1, &y, &r, &one, &m1, NULL);
    return err;
 }
 #endif
@@ -61,11 +61,17 @@ mp_err mp_prime_next_prime(mp_int *a, int t, bool bbs_style)
       }
    }
 
-   /* generate the restable */
-   for (x = 1; x < MP_PRIME_TAB_SIZE; x++) {
-      if ((err = mp_mod_d(a, s_mp_prime_tab[x], res_tab + x)) != MP_OKAY) {
+   /* generate the restable, in one pass over a if that is long enough */
+   if (MP_HAS(MP_MOD_D_MULTI) && (a->used >= MP_PRIME_TAB_MULTI_DIGITS)) {
+      if ((err = mp_mod_d_multi(a, s_mp_prime_tab + 1, MP_PRIME_TAB_SIZE - 1, res_tab + 1)) != MP_OKAY) {
          return err;
       }
+   } else {
+      for (x = 1; x < MP_PRIME_TAB_SIZE; x++) {
+         if ((err = s_mp_div_d_recip(a, &s_mp_prime_recip_tab[x], NULL, res_tab + x)) != MP_OKAY) {
+            return err;
+         }
+      }
    }
 
    /* init temp used for Miller-Rabin Testing */
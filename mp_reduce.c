@@ -48,7 +48,7 @@ mp_err mp_reduce(mp_int *x, const mp_int *m, const mp_int *mu)
    }
 
    /* q = q * m mod b**(k+1), quick (no division) */
-   if ((err = s_mp_mul(&q, m, &q, um + 1)) != MP_OKAY) {
+   if ((err = mp_mul_low(&q, m, um + 1, &q)) != MP_OKAY) {
       goto LBL_ERR;
    }
 
@@ -0,0 +1,12 @@
+#include "tommath_private.h"
+#ifdef MP_REDUCE_IS_SPECIAL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* determines if mp_reduce_special can be used */
+bool mp_reduce_is_special(const mp_int *a)
+{
+   mp_digit d;
+   return mp_reduce_special_setup(a, &d) == MP_OKAY;
+}
+#endif
@@ -0,0 +1,189 @@
+#include "tommath_private.h"
+#ifdef MP_REDUCE_SPECIAL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* reduces a modulo n, the prime d of mp_reduce_special_setup
+ *
+ * a is cut into words of 32 bits.  For P-256 and P-384 every word of the
+ * result is a short sum of the input words (Solinas' method), the others
+ * are 2**k - c with a small c and the bits from 2**k up are folded back
+ * times c.  Both leave a few multiples of n to add or subtract at the end.
+ *
+ * Values below zero or from 2**(2k) up go through mp_mod.
+ */
+
+/* room for a word and a digit */
+#if MP_DIGIT_BIT > 32
+typedef mp_word s_bits;
+#else
+typedef uint64_t s_bits;
+#endif
+
+/* the n words of |a| at w */
+static void s_get_words(const mp_int *a, uint32_t *w, int n)
+{
+   s_bits acc = 0u;
+   int i, d = 0, have = 0;
+
+   for (i = 0; i < n; i++) {
+      for (; (have < 32) && (d < a->used); have += MP_DIGIT_BIT) {
+         acc |= (s_bits)a->dp[d++] << have;
+      }
+      w[i] = (uint32_t)acc;
+      acc >>= 32;
+      have -= 32;
+   }
+}
+
+/* a = the n words at w */
+static mp_err s_set_words(mp_int *a, const uint32_t *w, int n)
+{
+   s_bits acc = 0u;
+   int i, l = 0, have = 0, oldused = a->used, digs = ((32 * n) + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT;
+   mp_err err;
+
+   if ((err = mp_grow(a, digs)) != MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < digs; i++) {
+      for (; (have < MP_DIGIT_BIT) && (l < n); have += 32) {
+         acc |= (s_bits)w[l++] << have;
+      }
+      a->dp[i] = (mp_digit)acc & MP_MASK;
+      acc >>= MP_DIGIT_BIT;
+      have -= MP_DIGIT_BIT;
+   }
+   a->used = digs;
+   a->sign = MP_ZPOS;
+   s_mp_zero_digs(a->dp + a->used, oldused - a->used);
+   mp_clamp(a);
+   return MP_OKAY;
+}
+
+/* w = the sums of the terms, in place as the word j of the input only
+ * turns up in the word j of the result, returns the carry out
+ */
+static int64_t s_solinas(uint32_t *w, const signed char *t, int n)
+{
+   int64_t acc = 0;
+   int j;
+
+   for (j = 0; j < n; j++) {
+      for (; *t != 0; t += 2) {
+         acc += (int64_t)t[0] * (int64_t)w[(int)t[1]];
+      }
+      t++;
+      w[j] = (uint32_t)acc;
+      acc = (acc - (int64_t)w[j]) / ((int64_t)1 << 32);
+   }
+   return acc;
+}
+
+/* w = w mod 2**k + (w / 2**k) * (c1 * 2**32 + c0) until w < 2**k, w has m words */
+static void s_fold(uint32_t *w, int m, int k, uint32_t c0, uint32_t c1)
+{
+   uint32_t h[2 * MP_SPECIAL_WORDS];
+   uint64_t acc;
+   int i, q = k / 32, s = k % 32, hn = m - q;
+   bool zero;
+
+   for (;;) {
+      zero = true;
+      for (i = 0; i < hn; i++) {
+         acc = (uint64_t)w[q + i];
+         if ((q + i + 1) < m) {
+            acc |= (uint64_t)w[q + i + 1] << 32;
+         }
+         h[i] = (uint32_t)(acc >> s);
+         zero = zero && (h[i] == 0u);
+      }
+      if (zero) {
+         return;
+      }
+
+      w[q] &= (uint32_t)((((uint64_t)1) << s) - 1u);
+      for (i = q + 1; i < m; i++) {
+         w[i] = 0u;
+      }
+      acc = 0u;
+      for (i = 0; i < m; i++) {
+         acc += (uint64_t)w[i];
+         if (i < hn) {
+            acc += (uint64_t)h[i] * c0;
+         }
+         if ((i > 0) && (i <= hn)) {
+            acc += (uint64_t)h[i - 1] * c1;
+         }
+         w[i] = (uint32_t)acc;
+         acc >>= 32;
+      }
+   }
+}
+
+/* w += p, returns the carry out */
+static int s_add_words(uint32_t *w, const uint32_t *p, int n)
+{
+   uint64_t acc = 0u;
+   int i;
+   for (i = 0; i < n; i++) {
+      acc += (uint64_t)w[i] + p[i];
+      w[i] = (uint32_t)acc;
+      acc >>= 32;
+   }
+   return (int)acc;
+}
+
+/* w -= p, returns the borrow out */
+static int s_sub_words(uint32_t *w, const uint32_t *p, int n)
+{
+   uint64_t acc = 0u;
+   int i;
+   for (i = 0; i < n; i++) {
+      acc = (uint64_t)w[i] - p[i] - acc;
+      w[i] = (uint32_t)acc;
+      acc = (acc >> 32) & 1u;
+   }
+   return (int)acc;
+}
+
+static bool s_geq_words(const uint32_t *w, const uint32_t *p, int n)
+{
+   int i;
+   for (i = n - 1; i >= 0; i--) {
+      if (w[i] != p[i]) {
+         return w[i] > p[i];
+      }
+   }
+   return true;
+}
+
+mp_err mp_reduce_special(mp_int *a, const mp_int *n, mp_digit d)
+{
+   uint32_t w[2 * MP_SPECIAL_WORDS];
+   const mp_special_prime *s = s_mp_special_prime(d);
+   int64_t top = 0;
+   int words;
+
+   if ((s == NULL) || mp_isneg(a) || (mp_count_bits(a) > (2 * s->bits))) {
+      return mp_mod(a, n, a);
+   }
+
+   words = (s->bits + 31) / 32;
+   s_get_words(a, w, 2 * words);
+   if (s->terms != NULL) {
+      top = s_solinas(w, s->terms, words);
+   } else {
+      s_fold(w, 2 * words, s->bits, s->c0, s->c1);
+   }
+
+   /* w + top * 2**(32*words) is a few n off */
+   while (top < 0) {
+      top += s_add_words(w, s->p, words);
+   }
+   while ((top > 0) || s_geq_words(w, s->p, words)) {
+      top -= s_sub_words(w, s->p, words);
+   }
+   return s_set_words(a, w, words);
+}
+#endif
@@ -0,0 +1,42 @@
+#include "tommath_private.h"
+#ifdef MP_REDUCE_SPECIAL_SETUP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* 32 bits of |a| starting at bit off */
+static uint32_t s_get_word(const mp_int *a, int off)
+{
+   int d = off / MP_DIGIT_BIT, s = off % MP_DIGIT_BIT, got = 0;
+   uint32_t r = 0u;
+   while ((got < 32) && (d < a->used)) {
+      r |= (uint32_t)(((uint64_t)(a->dp[d] >> s)) << got);
+      got += MP_DIGIT_BIT - s;
+      s = 0;
+      d++;
+   }
+   return r;
+}
+
+/* determines the index of the prime a, MP_VAL if mp_reduce_special does not know it */
+mp_err mp_reduce_special_setup(const mp_int *a, mp_digit *d)
+{
+   const mp_special_prime *s;
+   mp_digit i;
+   int j, bits = mp_count_bits(a);
+
+   if (mp_isneg(a)) {
+      return MP_VAL;
+   }
+   for (i = 0; (s = s_mp_special_prime(i)) != NULL; i++) {
+      if (s->bits != bits) {
+         continue;
+      }
+      for (j = 0; (j < ((bits + 31) / 32)) && (s_get_word(a, 32 * j) == s->p[j]); j++) {}
+      if (j == ((bits + 31) / 32)) {
+         *d = i;
+         return MP_OKAY;
+      }
+   }
+   return MP_VAL;
+}
+#endif
@@ -6,10 +6,13 @@
 /* c = a * a (mod b) */
 mp_err mp_sqrmod(const mp_int *a, const mp_int *b, mp_int *c)
 {
+   mp_digit k;
    mp_err err;
+   bool special = MP_HAS(MP_REDUCE_SPECIAL_SETUP) && MP_HAS(MP_REDUCE_SPECIAL) &&
+                  (mp_reduce_special_setup(b, &k) == MP_OKAY);
    if ((err = mp_sqr(a, c)) != MP_OKAY) {
       return err;
    }
-   return mp_mod(c, b, c);
+   return special ? mp_reduce_special(c, b, k) : mp_mod(c, b, c);
 }
 #endif
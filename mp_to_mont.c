@@ -0,0 +1,22 @@
+#include "tommath_private.h"
+#ifdef MP_TO_MONT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplies by R**2 and reduces once */
+mp_err mp_to_mont(const mp_int *a, const mp_mont_ctx *ctx, mp_int *c)
+{
+   mp_err err;
+
+   if (mp_isneg(a) || (mp_cmp_mag(a, &ctx->N) != MP_LT)) {
+      if ((err = mp_mod(a, &ctx->N, c)) != MP_OKAY) {
+         return err;
+      }
+      a = c;
+   }
+   if ((err = mp_mul(a, &ctx->RR, c)) != MP_OKAY) {
+      return err;
+   }
+   return mp_montgomery_reduce(c, &ctx->N, ctx->rho);
+}
+#endif
@@ -0,0 +1,34 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIGIT_RECIP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* the reciprocal of a digit b != 0 for s_mp_div_d_recip */
+void s_mp_digit_recip(mp_digit b, mp_digit_recip *r)
+{
+   mp_digit d = b;
+   int s = 0;
+
+   while ((d >> (MP_DIGIT_BIT - 8)) == 0u) {
+      d <<= 8;
+      s += 8;
+   }
+   while ((d >> (MP_DIGIT_BIT - 1)) == 0u) {
+      d <<= 1;
+      s++;
+   }
+   r->d = d;
+   r->shift = s;
+
+   /* (beta**2 - 1) / d - beta = ((beta - 1 - d) * beta + beta - 1) / d */
+   r->v = (mp_digit)(((((mp_word)(MP_MASK - d)) << MP_DIGIT_BIT) | (mp_word)MP_MASK) / d);
+
+   if (b <= (MP_MASK >> 2)) {
+      r->b1 = (mp_digit)(((mp_word)1 << MP_DIGIT_BIT) % b);
+      r->b2 = (mp_digit)(((mp_word)r->b1 * r->b1) % b);
+      r->b3 = (mp_digit)(((mp_word)r->b1 * r->b2) % b);
+   } else {
+      r->b1 = r->b2 = r->b3 = 0u;
+   }
+}
+#endif
@@ -0,0 +1,110 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_D_RECIP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* single digit division with a precomputed reciprocal
+ *
+ * The digits of a * 2**shift go from the top through the division of two
+ * digits by d = b * 2**shift, which is a product with v and a correction,
+ * the remainder is shifted back at the end.  Semantics as mp_div_d.
+ *
+ * Moeller, Niels, and Torbjoern Granlund. "Improved division by invariant
+ * integers", IEEE Transactions on Computers 60.2 (2011), algorithm 4.
+ *
+ * Without the quotient divisors b below beta / 4 need no division but the
+ * last, every two digits a1 * beta + a0 of a and the remainder r1 * beta + r0
+ * so far fold to r0 * beta**2 + r1 * beta**3 + a1 * beta + a0 mod b below
+ * beta**2, products with beta**i mod b which do not depend on each other.
+ * See "mod_1s_2p" of GMP.
+ */
+
+/* the remainder of a by b = r->d / 2**r->shift with r->b1 != 0 */
+static mp_digit s_mod_fold(const mp_int *a, const mp_digit_recip *r)
+{
+   mp_word  t;
+   mp_digit r1 = 0, r0 = 0, b = r->d >> r->shift;
+   int      ix = a->used;
+
+   if ((ix & 1) == 1) {
+      r0 = a->dp[--ix];
+   }
+   while (ix > 0) {
+      ix -= 2;
+      t  = ((mp_word)r0 * r->b2) + ((mp_word)r1 * r->b3);
+      t += ((mp_word)a->dp[ix + 1] * r->b1) + (mp_word)a->dp[ix];
+      r1 = (mp_digit)(t >> MP_DIGIT_BIT);
+      r0 = (mp_digit)(t & MP_MASK);
+   }
+   return (mp_digit)((((mp_word)r1 << MP_DIGIT_BIT) | (mp_word)r0) % b);
+}
+
+mp_err s_mp_div_d_recip(const mp_int *a, const mp_digit_recip *r, mp_int *c, mp_digit *d)
+{
+   mp_int   q;
+   mp_word  t;
+   mp_digit u, n, q1, q0, w;
+   int      ix, s = r->shift;
+   mp_err   err;
+
+   if ((c == NULL) && (r->b1 != 0u)) {
+      if (d != NULL) {
+         *d = s_mod_fold(a, r);
+      }
+      return MP_OKAY;
+   }
+
+   if (c != NULL) {
+      if ((err = mp_init_size(&q, a->used)) != MP_OKAY) {
+         return err;
+      }
+      q.used = a->used;
+      q.sign = a->sign;
+   }
+
+   /* the bits of the top digit shifted out are the first remainder, below d */
+   w = 0;
+   n = (a->used > 0) ? a->dp[a->used - 1] : 0u;
+   if (s > 0) {
+      w = n >> (MP_DIGIT_BIT - s);
+   }
+   for (ix = a->used; ix --> 0;) {
+      u = n << s;
+      n = (ix > 0) ? a->dp[ix - 1] : 0u;
+      if (s > 0) {
+         u |= n >> (MP_DIGIT_BIT - s);
+      }
+      u &= MP_MASK;
+
+      /* (w * beta + u) / d is q1 or one less or one more */
+      t  = ((mp_word)r->v * (mp_word)w) + (((mp_word)w << MP_DIGIT_BIT) | (mp_word)u);
+      q1 = (mp_digit)(((t >> MP_DIGIT_BIT) + 1u) & MP_MASK);
+      q0 = (mp_digit)(t & MP_MASK);
+      w  = (mp_digit)(((mp_word)u - ((mp_word)q1 * (mp_word)r->d)) & MP_MASK);
+      if (w > q0) {
+         q1 = (mp_digit)((q1 - 1u) & MP_MASK);
+         w  = (mp_digit)((w + r->d) & MP_MASK);
+      }
+      if (w >= r->d) {
+         q1++;
+         w -= r->d;
+      }
+
+      if (c != NULL) {
+         q.dp[ix] = q1;
+      }
+   }
+
+   if (d != NULL) {
+      *d = w >> s;
+   }
+
+   if (c != NULL) {
+      mp_clamp(&q);
+      mp_exch(&q, c);
+      mp_clear(&q);
+   }
+
+   return MP_OKAY;
+}
+#endif
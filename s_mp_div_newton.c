@@ -0,0 +1,112 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_NEWTON_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* integer division with a reciprocal from Newton's iteration
+ *
+ * For b of n digits v = beta**(2n) / |b| from s_mp_div_recip costs little
+ * more than a product of n by n/2 digits.  Then every n digits of the
+ * quotient are a Barrett reduction of the 2n top digits of the remainder
+ * with v, one product for the quotient and one short product for the
+ * remainder.
+ *
+ * Brent, Richard P., and Paul Zimmermann. "Modern computer arithmetic",
+ * algorithm 2.5 "BarrettDivRem".
+ *
+ * The reciprocal pays off once it serves a few of these steps, mp_div
+ * calls this for quotients of more than 3n digits, mp_div_with_ctx passes
+ * the one of its context as v, else v is NULL.  Semantics as mp_div.
+ */
+
+/* q = a / b, r = a mod b for 0 <= a < beta**(2n) with v about beta**(2n) / b */
+static mp_err s_barrett(const mp_int *a, const mp_int *b, const mp_int *v, mp_int *q, mp_int *r)
+{
+   mp_int t, m;
+   int n = b->used;
+   mp_err err;
+
+   if ((err = mp_init_multi(&t, &m, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* q = (a / beta**(n-1)) * v / beta**(n+1), a few off a / b */
+   if ((err = mp_div_2d(a, (n - 1) * MP_DIGIT_BIT, &t, NULL)) != MP_OKAY)  goto LBL_ERR;
+   if ((err = mp_mul(&t, v, q)) != MP_OKAY)                                goto LBL_ERR;
+   mp_rshd(q, n + 1);
+
+   /* r = a - q * b is small, the low n + 1 digits determine it */
+   if ((err = mp_mul_low(q, b, n + 1, &t)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_mod_2d(a, (n + 1) * MP_DIGIT_BIT, r)) != MP_OKAY)          goto LBL_ERR;
+   if ((err = mp_sub(r, &t, r)) != MP_OKAY)                                goto LBL_ERR;
+   if ((err = mp_2expt(&m, ((n + 1) * MP_DIGIT_BIT) - 1)) != MP_OKAY)      goto LBL_ERR;
+   if (mp_cmp(r, &m) != MP_LT) {
+      if ((err = mp_sub(r, &m, r)) != MP_OKAY)                             goto LBL_ERR;
+      if ((err = mp_sub(r, &m, r)) != MP_OKAY)                             goto LBL_ERR;
+   } else if (mp_cmp_mag(r, &m) == MP_GT) {
+      if ((err = mp_add(r, &m, r)) != MP_OKAY)                             goto LBL_ERR;
+      if ((err = mp_add(r, &m, r)) != MP_OKAY)                             goto LBL_ERR;
+   }
+
+   /* fix the few the quotient is off */
+   while (mp_isneg(r)) {
+      if ((err = mp_add(r, b, r)) != MP_OKAY)                              goto LBL_ERR;
+      if ((err = mp_decr(q)) != MP_OKAY)                                   goto LBL_ERR;
+   }
+   while (mp_cmp_mag(r, b) != MP_LT) {
+      if ((err = s_mp_sub(r, b, r)) != MP_OKAY)                            goto LBL_ERR;
+      if ((err = mp_incr(q)) != MP_OKAY)                                   goto LBL_ERR;
+   }
+
+LBL_ERR:
+   mp_clear_multi(&t, &m, NULL);
+   return err;
+}
+
+mp_err s_mp_div_newton(const mp_int *a, const mp_int *b, const mp_int *v, mp_int *c, mp_int *d)
+{
+   mp_int nb, w, q, r, qq, t;
+   int n = b->used, s;
+   bool neg = (a->sign != b->sign), aneg = mp_isneg(a);
+   mp_err err;
+
+   if ((err = mp_init_multi(&nb, &w, &q, &r, &qq, &t, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* v about beta**(2n) / |b|, s_barrett corrects the quotients */
+   if ((err = mp_abs(b, &nb)) != MP_OKAY)                                  goto LBL_ERR;
+   if (v == NULL) {
+      if ((err = s_mp_div_recip(&nb, &w)) != MP_OKAY)                      goto LBL_ERR;
+      v = &w;
+   }
+
+   /* n digits of the quotient at a time from the top 2n digits of the remainder */
+   if ((err = mp_abs(a, &r)) != MP_OKAY)                                   goto LBL_ERR;
+   while (r.used > (2 * n)) {
+      s = r.used - (2 * n);
+      if ((err = mp_div_2d(&r, s * MP_DIGIT_BIT, &t, &r)) != MP_OKAY)      goto LBL_ERR;
+      if ((err = s_barrett(&t, &nb, v, &qq, &t)) != MP_OKAY)              goto LBL_ERR;
+      if ((err = mp_lshd(&t, s)) != MP_OKAY)                               goto LBL_ERR;
+      if ((err = s_mp_add(&r, &t, &r)) != MP_OKAY)                         goto LBL_ERR;
+      if ((err = mp_lshd(&qq, s)) != MP_OKAY)                              goto LBL_ERR;
+      if ((err = s_mp_add(&q, &qq, &q)) != MP_OKAY)                        goto LBL_ERR;
+   }
+   if ((err = s_barrett(&r, &nb, v, &qq, &r)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = s_mp_add(&q, &qq, &q)) != MP_OKAY)                           goto LBL_ERR;
+
+   /* the signs as s_mp_div_school has them */
+   if (c != NULL) {
+      q.sign = (!mp_iszero(&q) && neg) ? MP_NEG : MP_ZPOS;
+      mp_exch(&q, c);
+   }
+   if (d != NULL) {
+      r.sign = (!mp_iszero(&r) && aneg) ? MP_NEG : MP_ZPOS;
+      mp_exch(&r, d);
+   }
+
+LBL_ERR:
+   mp_clear_multi(&nb, &w, &q, &r, &qq, &t, NULL);
+   return err;
+}
+#endif
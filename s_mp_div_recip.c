@@ -0,0 +1,59 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIV_RECIP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* v = beta**(2t) / b for b > 0 of t digits, off by a few
+ *
+ * Newton's iteration x = x + x * (beta**(2t) - b * x) / beta**(2t) from
+ * the reciprocal of the top half of b, every step doubles the number of
+ * correct digits.  Below MP_DIV_NEWTON_CUTOFF digits it divides.
+ *
+ * Brent, Richard P., and Paul Zimmermann. "Modern computer arithmetic",
+ * algorithm 3.5 "Approximate reciprocal".
+ */
+mp_err s_mp_div_recip(const mp_int *b, mp_int *v)
+{
+   mp_int bh, w, e;
+   int t = b->used, h, l;
+   mp_err err;
+
+   /* small enough to divide, the split below needs t > 5 */
+   if (t < MP_MAX(MP_DIV_NEWTON_CUTOFF, 8)) {
+      if ((err = mp_2expt(v, 2 * t * MP_DIGIT_BIT)) != MP_OKAY) {
+         return err;
+      }
+      return mp_div(v, b, v, NULL);
+   }
+
+   if ((err = mp_init_multi(&bh, &w, &e, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* w = beta**(2h) / bh for the top h digits, a few more than half for the truncations */
+   h = (t + 5) / 2;
+   l = t - h;
+   if ((err = mp_div_2d(b, l * MP_DIGIT_BIT, &bh, NULL)) != MP_OKAY)       goto LBL_ERR;
+   if ((err = s_mp_div_recip(&bh, &w)) != MP_OKAY)                                goto LBL_ERR;
+
+   /* with x = w * beta**l, beta**(2t) - b * x = e * beta**l */
+   if ((err = mp_mul(b, &w, &e)) != MP_OKAY)                               goto LBL_ERR;
+   if ((err = mp_2expt(v, ((2 * h) + l) * MP_DIGIT_BIT)) != MP_OKAY)       goto LBL_ERR;
+   if ((err = mp_sub(v, &e, &e)) != MP_OKAY)                               goto LBL_ERR;
+
+   /* v = x + x * e * beta**l / beta**(2t) = w * beta**l + w * e / beta**(2h),
+    * e has about h + l digits, the correction about l, so w and e are cut
+    * to a few more than l digits first
+    */
+   mp_rshd(&e, h - 2);
+   if ((err = mp_div_2d(&w, (h - l - 2) * MP_DIGIT_BIT, &bh, NULL)) != MP_OKAY) goto LBL_ERR;
+   if ((err = mp_mul(&bh, &e, &e)) != MP_OKAY)                             goto LBL_ERR;
+   mp_rshd(&e, l + 4);
+   if ((err = mp_lshd(&w, l)) != MP_OKAY)                                  goto LBL_ERR;
+   err = mp_add(&w, &e, v);
+
+LBL_ERR:
+   mp_clear_multi(&bh, &w, &e, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,100 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIVEXACT_HENSEL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a / b for a >= 0 a multiple of an odd b > 0
+ *
+ * The quotient of m digits is a * b**-1 mod beta**m.  The inverse comes
+ * from Hensel lifting, x = x * (2 - b * x) doubles the number of correct
+ * digits, with b * x = 1 + beta**k * h mod beta**(2k) the new digits are
+ * -x * h mod beta**k.  All of it are short products, mp_mul_low.
+ *
+ * The inverse goes to at most n digits for b of n digits.  Longer quotients
+ * take n digits at a time from the low end of a, the part of the products of
+ * b with the quotient digits so far above them is carried along, i.e. a
+ * Barrett reduction from the other end.
+ */
+
+/* t = digits i to i + l of a */
+static mp_err s_digits(const mp_int *a, int i, int l, mp_int *t)
+{
+   mp_err err;
+   l = MP_MAX(MP_MIN(l, a->used - i), 0);
+   if ((err = mp_grow(t, l)) != MP_OKAY) {
+      return err;
+   }
+   s_mp_copy_digs(t->dp, a->dp + i, l);
+   s_mp_zero_digs(t->dp + l, t->used - l);
+   t->used = l;
+   t->sign = MP_ZPOS;
+   mp_clamp(t);
+   return MP_OKAY;
+}
+
+mp_err s_mp_divexact_hensel(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int x, t, h, d, q;
+   mp_digit rho;
+   int m = (a->used - b->used) + 1, n = MP_MIN(m, b->used), i, k, l;
+   mp_err err;
+
+   if (m <= 0) {
+      mp_zero(c);
+      return MP_OKAY;
+   }
+
+   if ((err = mp_montgomery_setup(b, &rho)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_multi(&x, &t, &h, &d, &q, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* 1/b mod beta, then the digits up to n */
+   mp_set(&x, (mp_digit)(((mp_word)1 << (mp_word)MP_DIGIT_BIT) - rho) & MP_MASK);
+   for (k = 1; k < n; k = l) {
+      l = MP_MIN(2 * k, n);
+      if ((err = mp_mod_2d(b, l * MP_DIGIT_BIT, &t)) != MP_OKAY)       goto LBL_ERR;
+      if ((err = mp_mul_low(&t, &x, l, &t)) != MP_OKAY)                goto LBL_ERR;
+      if ((err = mp_div_2d(&t, k * MP_DIGIT_BIT, &h, NULL)) != MP_OKAY) goto LBL_ERR;
+      if ((err = mp_mul_low(&x, &h, l - k, &h)) != MP_OKAY)            goto LBL_ERR;
+      if (!mp_iszero(&h)) {
+         if ((err = mp_2expt(&t, (l - k) * MP_DIGIT_BIT)) != MP_OKAY)  goto LBL_ERR;
+         if ((err = mp_sub(&t, &h, &h)) != MP_OKAY)                    goto LBL_ERR;
+         if ((err = mp_lshd(&h, k)) != MP_OKAY)                        goto LBL_ERR;
+         if ((err = mp_add(&x, &h, &x)) != MP_OKAY)                    goto LBL_ERR;
+      }
+   }
+
+   /* the quotient digits i to i + l from the same digits of a - d */
+   if ((err = mp_grow(&q, m)) != MP_OKAY)                              goto LBL_ERR;
+   for (i = 0; i < m; i += l) {
+      l = MP_MIN(n, m - i);
+      /* t = a - d mod beta**l, then l quotient digits */
+      if ((err = s_digits(a, i, l, &t)) != MP_OKAY)                    goto LBL_ERR;
+      if ((err = s_digits(&d, 0, l, &h)) != MP_OKAY)                   goto LBL_ERR;
+      if ((err = mp_sub(&t, &h, &t)) != MP_OKAY)                       goto LBL_ERR;
+      if (mp_isneg(&t)) {
+         if ((err = mp_2expt(&h, l * MP_DIGIT_BIT)) != MP_OKAY)        goto LBL_ERR;
+         if ((err = mp_add(&t, &h, &t)) != MP_OKAY)                    goto LBL_ERR;
+      }
+      if ((err = mp_mul_low(&t, &x, l, &h)) != MP_OKAY)                goto LBL_ERR;
+      s_mp_copy_digs(q.dp + i, h.dp, h.used);
+
+      /* d = (d + h * b) / beta**l */
+      if ((i + l) < m) {
+         if ((err = mp_mul(&h, b, &t)) != MP_OKAY)                     goto LBL_ERR;
+         if ((err = s_mp_add(&d, &t, &d)) != MP_OKAY)                  goto LBL_ERR;
+         mp_rshd(&d, l);
+      }
+   }
+   q.used = m;
+   mp_clamp(&q);
+   mp_exch(&q, c);
+
+LBL_ERR:
+   mp_clear_multi(&x, &t, &h, &d, &q, NULL);
+   return err;
+}
+#endif
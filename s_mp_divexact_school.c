@@ -0,0 +1,76 @@
+#include "tommath_private.h"
+#ifdef S_MP_DIVEXACT_SCHOOL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = a / b for a >= 0 a multiple of an odd b > 0
+ *
+ * Jebelean's exact division from the low end, the digits of the quotient
+ * are q_i = r_i / b_0 mod beta with the remainder r = a - q * b so far.
+ * Only the digits below the length of the quotient are kept up to date and
+ * there are no trial quotients to correct, which makes it about twice as
+ * fast as s_mp_div_school.
+ *
+ * Jebelean, Tudor. "An algorithm for exact division." Journal of Symbolic
+ * Computation 15.2 (1993): 169-180.
+ */
+mp_err s_mp_divexact_school(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int r, q;
+   mp_digit binv, qi, *rp;
+   mp_word t, cy;
+   int i, j, m, n;
+   mp_err err;
+
+   m = (a->used - b->used) + 1;
+   if (m <= 0) {
+      mp_zero(c);
+      return MP_OKAY;
+   }
+
+   /* 1/b_0 mod beta */
+   if ((err = mp_montgomery_setup(b, &binv)) != MP_OKAY) {
+      return err;
+   }
+   binv = (mp_digit)(((mp_word)1 << (mp_word)MP_DIGIT_BIT) - binv) & MP_MASK;
+
+   if ((err = mp_init_size(&q, m)) != MP_OKAY) {
+      return err;
+   }
+   if ((err = mp_init_copy(&r, a)) != MP_OKAY) {
+      goto LBL_Q;
+   }
+
+   rp = r.dp;
+   for (i = 0; i < m; i++) {
+      qi = (rp[i] * binv) & MP_MASK;
+      q.dp[i] = qi;
+
+      /* r = r - qi * b * beta**i, below beta**m */
+      n = MP_MIN(b->used, m - i);
+      cy = 0;
+      for (j = 0; j < n; j++) {
+         t = ((mp_word)qi * (mp_word)b->dp[j]) + cy;
+         cy = t >> MP_DIGIT_BIT;
+         /* a borrow wraps around and sets the top bit */
+         t = (mp_word)rp[i + j] - (t & MP_MASK);
+         rp[i + j] = (mp_digit)(t & MP_MASK);
+         cy += t >> (MP_SIZEOF_BITS(mp_word) - 1u);
+      }
+      for (j = i + n; (j < m) && (cy != 0u); j++) {
+         t = (mp_word)rp[j] - cy;
+         rp[j] = (mp_digit)(t & MP_MASK);
+         cy = t >> (MP_SIZEOF_BITS(mp_word) - 1u);
+      }
+   }
+
+   q.used = m;
+   mp_clamp(&q);
+   mp_exch(&q, c);
+
+   mp_clear(&r);
+LBL_Q:
+   mp_clear(&q);
+   return err;
+}
+#endif
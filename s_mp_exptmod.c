@@ -13,10 +13,12 @@
 
 mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode)
 {
-   mp_int  M[TAB_SIZE], res, mu;
+   mp_int  M[TAB_SIZE], res, mu, t;
    mp_digit buf;
    mp_err   err;
    int      bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
+   void    *mem;
+   size_t  size;
    mp_err(*redux)(mp_int *x, const mp_int *m, const mp_int *mu);
 
    /* find window size */
@@ -39,23 +41,11 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
 
    winsize = MAX_WINSIZE ? MP_MIN(MAX_WINSIZE, winsize) : winsize;
 
-   /* init M array */
-   /* init first cell */
-   if ((err = mp_init(&M[1])) != MP_OKAY) {
+   /* init M array, one allocation for all entries */
+   if ((err = s_mp_exptmod_table(M, winsize, P->used, &mem, &size)) != MP_OKAY) {
       return err;
    }
 
-   /* now init the second half of the array */
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      if ((err = mp_init(&M[x])) != MP_OKAY) {
-         for (y = 1<<(winsize-1); y < x; y++) {
-            mp_clear(&M[y]);
-         }
-         mp_clear(&M[1]);
-         return err;
-      }
-   }
-
    /* create mu, used for Barrett reduction */
    if ((err = mp_init(&mu)) != MP_OKAY)                           goto LBL_M;
 
@@ -67,6 +57,9 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
       redux = mp_reduce_2k_l;
    }
 
+   /* the scratch the entries are computed in */
+   if ((err = mp_init_size(&t, (2 * P->used) + 1)) != MP_OKAY)     goto LBL_MU;
+
    /* create M table
     *
     * The M table contains powers of the base,
@@ -75,32 +68,32 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
     * The first half of the table is not
     * computed though accept for M[0] and M[1]
     */
-   if ((err = mp_mod(G, P, &M[1])) != MP_OKAY)                    goto LBL_MU;
+   if ((err = mp_mod(G, P, &t)) != MP_OKAY)                       goto LBL_T;
+   if ((err = mp_copy(&t, &M[1])) != MP_OKAY)                     goto LBL_T;
 
    /* compute the value at M[1<<(winsize-1)] by squaring
     * M[1] (winsize-1) times
     */
-   if ((err = mp_copy(&M[1], &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_MU;
-
    for (x = 0; x < (winsize - 1); x++) {
       /* square it */
-      if ((err = mp_sqr(&M[(size_t)1 << (winsize - 1)],
-                        &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_MU;
+      if ((err = mp_sqr(&t, &t)) != MP_OKAY)                      goto LBL_T;
 
       /* reduce modulo P */
-      if ((err = redux(&M[(size_t)1 << (winsize - 1)], P, &mu)) != MP_OKAY) goto LBL_MU;
+      if ((err = redux(&t, P, &mu)) != MP_OKAY)                   goto LBL_T;
    }
+   if ((err = mp_copy(&t, &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_T;
 
    /* create upper table, that is M[x] = M[x-1] * M[1] (mod P)
     * for x = (2**(winsize - 1) + 1) to (2**winsize - 1)
     */
    for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
-      if ((err = mp_mul(&M[x - 1], &M[1], &M[x])) != MP_OKAY)     goto LBL_MU;
-      if ((err = redux(&M[x], P, &mu)) != MP_OKAY)                goto LBL_MU;
+      if ((err = mp_mul(&M[x - 1], &M[1], &t)) != MP_OKAY)        goto LBL_T;
+      if ((err = redux(&t, P, &mu)) != MP_OKAY)                   goto LBL_T;
+      if ((err = mp_copy(&t, &M[x])) != MP_OKAY)                  goto LBL_T;
    }
 
    /* setup result */
-   if ((err = mp_init(&res)) != MP_OKAY)                          goto LBL_MU;
+   if ((err = mp_init(&res)) != MP_OKAY)                          goto LBL_T;
    mp_set(&res, 1uL);
 
    /* set initial mode and bit cnt */
@@ -186,13 +179,12 @@ mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y
    err = MP_OKAY;
 LBL_RES:
    mp_clear(&res);
+LBL_T:
+   mp_clear(&t);
 LBL_MU:
    mp_clear(&mu);
 LBL_M:
-   mp_clear(&M[1]);
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      mp_clear(&M[x]);
-   }
+   MP_FREE_BUF(mem, size);
    return err;
 }
 #endif
@@ -0,0 +1,259 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD4_AVX2_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y[k] == G[k]**X[k] mod P[k] for k < 4 and odd P[k] with AVX2
+ *
+ * Four independent exponentiations are interleaved, each 64 bit lane of the
+ * vectors holds one of them ("multi-buffer").  The numbers are kept in limbs
+ * of 28 bits, vpmuludq multiplies the low 32 bits of the lanes to 64 bits.
+ *
+ * The Montgomery multiplication is the word-serial one with the reduction
+ * fused into the multiplication, as s_mp_montgomery_reduce_comba does it,
+ * but the lanes accumulate the partial products without carry propagation,
+ * every column gets at most 2n products below 2**56, which limits n to 127
+ * limbs.  With R = 2**(28n) > 4P all values stay below 2P and no conditional
+ * subtraction is needed until the very end, as in s_mp_exptmod_ifma.
+ *
+ * All lanes use the same number of limbs and the same window positions,
+ * moduli of about the same size and exponents of about the same length
+ * waste the least.  Uses a left-to-right fixed window.
+ *
+ * The functions are compiled for the extension, s_mp_kernels() only picks
+ * them if the CPU has it.
+ */
+
+/* the intrinsics headers are not C89 clean, which -Wsystem-headers would report */
+#ifdef __GNUC__
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeclaration-after-statement"
+#endif
+#include <immintrin.h>
+#ifdef __GNUC__
+#   pragma GCC diagnostic pop
+#endif
+
+#define MP_AVX2_BITS 28
+#define MP_AVX2_MASK ((((uint64_t)1) << MP_AVX2_BITS) - 1u)
+#define MP_AVX2_LANES 4
+#define MP_AVX2_TARGET __attribute__((target("avx2")))
+
+/* 28 bits of |a| starting at bit off */
+static uint64_t s_avx2_get_limb(const mp_int *a, int off)
+{
+   int d = off / MP_DIGIT_BIT, s = off % MP_DIGIT_BIT, got = 0;
+   uint64_t r = 0u;
+   while ((got < MP_AVX2_BITS) && (d < a->used)) {
+      r |= ((uint64_t)(a->dp[d] >> s)) << got;
+      got += MP_DIGIT_BIT - s;
+      s = 0;
+      d++;
+   }
+   return r & MP_AVX2_MASK;
+}
+
+/* lane k of the n limbs at r = a */
+static void s_avx2_from_mp(const mp_int *a, uint64_t *r, int n, int k)
+{
+   int i;
+   for (i = 0; i < n; i++) {
+      r[(i * MP_AVX2_LANES) + k] = s_avx2_get_limb(a, i * MP_AVX2_BITS);
+   }
+}
+
+/* a = lane k of the n limbs at r */
+static mp_err s_avx2_to_mp(const uint64_t *r, int n, int k, mp_int *a)
+{
+   int i, oldused = a->used, digs = ((n * MP_AVX2_BITS) + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT;
+   mp_err err;
+
+   if ((err = mp_grow(a, digs)) != MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < digs; i++) {
+      int off = i * MP_DIGIT_BIT, l = off / MP_AVX2_BITS, s = off % MP_AVX2_BITS, got = 0;
+      mp_digit d = 0u;
+      while ((got < MP_DIGIT_BIT) && (l < n)) {
+         d |= (mp_digit)((r[(l * MP_AVX2_LANES) + k] >> s) << got);
+         got += MP_AVX2_BITS - s;
+         s = 0;
+         l++;
+      }
+      a->dp[i] = d & MP_MASK;
+   }
+   a->used = digs;
+   a->sign = MP_ZPOS;
+   s_mp_zero_digs(a->dp + a->used, oldused - a->used);
+   mp_clamp(a);
+   return MP_OKAY;
+}
+
+/* r = a * b / 2**(28*n) mod m in every lane with a, b < 2m, result < 2m.
+ * r may alias a or b, t has 2n + 1 vectors
+ */
+MP_AVX2_TARGET static void s_avx2_amm(__m256i *r, const __m256i *a, const __m256i *b, const __m256i *m, __m256i minv,
+                                      int n, __m256i *t)
+{
+   const __m256i mask = _mm256_set1_epi64x((long long)MP_AVX2_MASK);
+   __m256i ai, q, c;
+   int i, j;
+
+   for (j = 0; j <= (2 * n); j++) {
+      t[j] = _mm256_setzero_si256();
+   }
+
+   for (i = 0; i < n; i++) {
+      ai = _mm256_load_si256(a + i);
+
+      /* q = (t_i + a_i * b_0) * -1/m mod 2**28 zeroes the limb */
+      t[i] = _mm256_add_epi64(t[i], _mm256_mul_epu32(ai, _mm256_load_si256(b)));
+      q = _mm256_and_si256(_mm256_mul_epu32(_mm256_and_si256(t[i], mask), minv), mask);
+      t[i] = _mm256_add_epi64(t[i], _mm256_mul_epu32(q, _mm256_load_si256(m)));
+
+      /* t += (a_i * b + q * m) * 2**(28i) */
+      for (j = 1; j < n; j++) {
+         t[i + j] = _mm256_add_epi64(t[i + j],
+                                     _mm256_add_epi64(_mm256_mul_epu32(ai, _mm256_load_si256(b + j)),
+                                                      _mm256_mul_epu32(q, _mm256_load_si256(m + j))));
+      }
+      t[i + 1] = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(t[i], MP_AVX2_BITS));
+   }
+
+   /* normalize to 28 bit limbs */
+   c = _mm256_setzero_si256();
+   for (j = 0; j < n; j++) {
+      c = _mm256_add_epi64(t[n + j], c);
+      _mm256_store_si256(r + j, _mm256_and_si256(c, mask));
+      c = _mm256_srli_epi64(c, MP_AVX2_BITS);
+   }
+}
+
+MP_AVX2_TARGET mp_err s_mp_exptmod4_avx2(const mp_int *const G[], const mp_int *const X[], const mp_int *const P[],
+      mp_int *const Y[])
+{
+   int n, i, j, k, winsize, bits, x[MP_AVX2_LANES];
+   uint64_t *buf, *base, m0, minv[MP_AVX2_LANES];
+   __m256i *m, *t, *res, *rr, *u, *tab, vminv;
+   size_t size;
+   mp_int a, r[MP_AVX2_LANES];
+   mp_err err;
+
+   /* limb count such that R = 2**(28*n) > 4P for all moduli */
+   bits = 0;
+   for (k = 0; k < MP_AVX2_LANES; k++) {
+      if (mp_isneg(P[k]) || mp_iseven(P[k]) || mp_isneg(X[k])) {
+         return MP_VAL;
+      }
+      bits = MP_MAX(bits, mp_count_bits(P[k]));
+   }
+   if (bits > MP_AVX2_MAX_BITS) {
+      return MP_VAL;
+   }
+   n = (bits + 2 + (MP_AVX2_BITS - 1)) / MP_AVX2_BITS;
+
+   bits = 0;
+   for (k = 0; k < MP_AVX2_LANES; k++) {
+      bits = MP_MAX(bits, mp_count_bits(X[k]));
+   }
+   winsize = (bits <= 36) ? 3 : ((bits <= 140) ? 4 : 5);
+
+   /* modulus, accumulator, result, R**2, a temporary and the table, aligned to 32 bytes */
+   size = (sizeof(__m256i) * (((size_t)n * (4u + ((size_t)1 << winsize))) + 1u + ((size_t)n * 2u))) + 32u;
+   buf = (uint64_t *) MP_MALLOC(size);
+   if (buf == NULL) {
+      return MP_MEM;
+   }
+   base = (uint64_t *)(void *)(((uintptr_t)buf + 31u) & ~(uintptr_t)31u);
+   m = (__m256i *)(void *)base;
+   t = m + n;
+   res = t + ((2 * n) + 1);
+   rr = res + n;
+   u = rr + n;
+   tab = u + n;
+
+   if ((err = mp_init_multi(&a, &r[0], &r[1], &r[2], &r[3], NULL)) != MP_OKAY) {
+      goto LBL_BUF;
+   }
+
+   for (k = 0; k < MP_AVX2_LANES; k++) {
+      /* -1/P mod 2**28 */
+      s_avx2_from_mp(P[k], (uint64_t *)(void *)m, n, k);
+      m0 = ((uint64_t *)(void *)m)[k];
+      minv[k] = m0;
+      for (i = 0; i < 5; i++) {
+         minv[k] *= 2u - (m0 * minv[k]);
+      }
+      minv[k] = (0u - minv[k]) & MP_AVX2_MASK;
+
+      /* R**2 mod P and G mod P */
+      if ((err = mp_2expt(&a, 2 * MP_AVX2_BITS * n)) != MP_OKAY)   goto LBL_A;
+      if ((err = mp_mod(&a, P[k], &a)) != MP_OKAY)                  goto LBL_A;
+      s_avx2_from_mp(&a, (uint64_t *)(void *)rr, n, k);
+      if ((err = mp_mod(G[k], P[k], &a)) != MP_OKAY)                goto LBL_A;
+      s_avx2_from_mp(&a, (uint64_t *)(void *)res, n, k);
+   }
+   vminv = _mm256_set_epi64x((long long)minv[3], (long long)minv[2], (long long)minv[1], (long long)minv[0]);
+
+   /* tab[0] = R mod P, tab[1] = G * R mod P */
+   s_avx2_amm(tab + n, res, rr, m, vminv, n, t);
+   for (j = 0; j < n; j++) {
+      u[j] = _mm256_setzero_si256();
+   }
+   u[0] = _mm256_set1_epi64x(1);
+   s_avx2_amm(tab, u, rr, m, vminv, n, t);
+   for (j = 2; j < (1 << winsize); j++) {
+      s_avx2_amm(tab + (j * n), tab + ((j - 1) * n), tab + n, m, vminv, n, t);
+   }
+
+   /* left-to-right fixed window, every lane picks its own table entry */
+   for (j = 0; j < n; j++) {
+      res[j] = tab[j];
+   }
+   for (i = ((bits + (winsize - 1)) / winsize) - 1; i >= 0; i--) {
+      for (k = 0; k < MP_AVX2_LANES; k++) {
+         x[k] = 0;
+         for (j = winsize - 1; j >= 0; j--) {
+            x[k] = (x[k] << 1) | (s_mp_get_bit(X[k], (i * winsize) + j) ? 1 : 0);
+         }
+      }
+      for (j = 0; j < n; j++) {
+         u[j] = _mm256_blend_epi32(_mm256_blend_epi32(tab[(x[0] * n) + j], tab[(x[1] * n) + j], 0x0C),
+                                   _mm256_blend_epi32(tab[(x[2] * n) + j], tab[(x[3] * n) + j], 0xC0), 0xF0);
+      }
+      if (i == (((bits + (winsize - 1)) / winsize) - 1)) {
+         for (j = 0; j < n; j++) {
+            res[j] = u[j];
+         }
+         continue;
+      }
+      for (j = 0; j < winsize; j++) {
+         s_avx2_amm(res, res, res, m, vminv, n, t);
+      }
+      s_avx2_amm(res, res, u, m, vminv, n, t);
+   }
+
+   /* leave the Montgomery domain, the results are at most P */
+   for (j = 0; j < n; j++) {
+      u[j] = _mm256_setzero_si256();
+   }
+   u[0] = _mm256_set1_epi64x(1);
+   s_avx2_amm(res, res, u, m, vminv, n, t);
+   for (k = 0; k < MP_AVX2_LANES; k++) {
+      if ((err = s_avx2_to_mp((uint64_t *)(void *)res, n, k, &r[k])) != MP_OKAY) goto LBL_A;
+      if (mp_cmp_mag(&r[k], P[k]) != MP_LT) {
+         if ((err = s_mp_sub(&r[k], P[k], &r[k])) != MP_OKAY)        goto LBL_A;
+      }
+   }
+   for (k = 0; k < MP_AVX2_LANES; k++) {
+      mp_exch(&r[k], Y[k]);
+   }
+
+LBL_A:
+   mp_clear_multi(&a, &r[0], &r[1], &r[2], &r[3], NULL);
+LBL_BUF:
+   MP_FREE_BUF(buf, size);
+   return err;
+}
+
+#endif
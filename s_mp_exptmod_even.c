@@ -0,0 +1,156 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_EVEN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P for even P > 0 and X >= 0
+ *
+ * P = 2**k * m with odd m.  G**X mod m is an odd modulus exponentiation
+ * of mp_exptmod, G**X mod 2**k needs no reduction but the cut to k bits,
+ * the products are only computed to the digits below 2**k.  Both are
+ * combined with the CRT, Y = y1 + m * ((y2 - y1) / m mod 2**k).
+ */
+
+#ifdef MP_LOW_MEM
+#   define TAB_SIZE 32
+#   define MAX_WINSIZE 5
+#else
+#   define TAB_SIZE 256
+#   define MAX_WINSIZE 0
+#endif
+
+/* c = a * b mod 2**k, a and b >= 0 of at most digs digits */
+static mp_err s_mul_2k(const mp_int *a, const mp_int *b, mp_int *c, int digs, int k)
+{
+   mp_err err;
+   if ((err = mp_mul_low(a, b, digs, c)) != MP_OKAY) {
+      return err;
+   }
+   return mp_mod_2d(c, k, c);
+}
+
+/* Y = G**X mod 2**k for 0 <= G < 2**k and X >= 0 */
+static mp_err s_exptmod_2k(const mp_int *G, const mp_int *X, int k, mp_int *Y)
+{
+   mp_int  M[TAB_SIZE], res, e;
+   int     i, j, v, bits, digs, winsize;
+   void    *mem;
+   size_t  size;
+   mp_err  err;
+
+   if ((err = mp_init(&e)) != MP_OKAY) {
+      return err;
+   }
+
+   /* odd G have an order dividing 2**(k-2), from 2**k on even G only leave 0 */
+   if (mp_isodd(G)) {
+      if ((err = mp_mod_2d(X, MP_MAX(k - 2, 1), &e)) != MP_OKAY) goto LBL_E;
+   } else if ((mp_count_bits(X) > 30) || (mp_get_i32(X) >= (int32_t)k)) {
+      mp_zero(Y);
+      goto LBL_E;
+   } else if ((err = mp_copy(X, &e)) != MP_OKAY) {
+      goto LBL_E;
+   }
+
+   if (mp_iszero(&e)) {
+      mp_set(Y, 1uL);
+      err = mp_mod_2d(Y, k, Y);
+      goto LBL_E;
+   }
+
+   bits = mp_count_bits(&e);
+   if (bits <= 7) {
+      winsize = 2;
+   } else if (bits <= 36) {
+      winsize = 3;
+   } else if (bits <= 140) {
+      winsize = 4;
+   } else if (bits <= 450) {
+      winsize = 5;
+   } else if (bits <= 1303) {
+      winsize = 6;
+   } else if (bits <= 3529) {
+      winsize = 7;
+   } else {
+      winsize = 8;
+   }
+
+   winsize = MAX_WINSIZE ? MP_MIN(MAX_WINSIZE, winsize) : winsize;
+
+   /* the odd powers G, G**3, ... at M[2**(w-1)], G**2 at M[1] */
+   digs = (k + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT;
+   if ((err = s_mp_exptmod_table(M, winsize, digs, &mem, &size)) != MP_OKAY) goto LBL_E;
+   if ((err = mp_init_size(&res, (2 * digs) + 1)) != MP_OKAY)                 goto LBL_M;
+
+   if ((err = mp_copy(G, &M[1 << (winsize - 1)])) != MP_OKAY)               goto LBL_RES;
+   if ((err = s_mul_2k(G, G, &res, digs, k)) != MP_OKAY)                     goto LBL_RES;
+   if ((err = mp_copy(&res, &M[1])) != MP_OKAY)                              goto LBL_RES;
+   for (i = (1 << (winsize - 1)) + 1; i < (1 << winsize); i++) {
+      if ((err = s_mul_2k(&M[i - 1], &M[1], &res, digs, k)) != MP_OKAY)     goto LBL_RES;
+      if ((err = mp_copy(&res, &M[i])) != MP_OKAY)                          goto LBL_RES;
+   }
+
+   /* left-to-right sliding window over the odd windows of e */
+   mp_set(&res, 1uL);
+   for (i = bits - 1; i >= 0;) {
+      if (!s_mp_get_bit(&e, i)) {
+         if ((err = s_mul_2k(&res, &res, &res, digs, k)) != MP_OKAY)        goto LBL_RES;
+         i--;
+         continue;
+      }
+      for (j = MP_MAX(i - winsize + 1, 0); !s_mp_get_bit(&e, j); j++) {}
+      for (v = 0; i >= j; i--) {
+         v = (v << 1) | (s_mp_get_bit(&e, i) ? 1 : 0);
+         if ((err = s_mul_2k(&res, &res, &res, digs, k)) != MP_OKAY)        goto LBL_RES;
+      }
+      if ((err = s_mul_2k(&res, &M[(1 << (winsize - 1)) + (v >> 1)], &res, digs, k)) != MP_OKAY) goto LBL_RES;
+   }
+
+   mp_exch(&res, Y);
+LBL_RES:
+   mp_clear(&res);
+LBL_M:
+   MP_FREE_BUF(mem, size);
+LBL_E:
+   mp_clear(&e);
+   return err;
+}
+
+mp_err s_mp_exptmod_even(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y)
+{
+   mp_int g, m, y1, y2, t;
+   int k = mp_cnt_lsb(P);
+   mp_err err;
+
+   if ((err = mp_init_multi(&g, &m, &y1, &y2, &t, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* G**X mod 2**k */
+   if ((err = mp_mod(G, P, &g)) != MP_OKAY)                          goto LBL_ERR;
+   if ((err = mp_mod_2d(&g, k, &t)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = s_exptmod_2k(&t, X, k, &y2)) != MP_OKAY)               goto LBL_ERR;
+
+   if ((err = mp_div_2d(P, k, &m, NULL)) != MP_OKAY)                 goto LBL_ERR;
+   if (mp_cmp_d(&m, 1uL) == MP_EQ) {
+      mp_exch(&y2, Y);
+      goto LBL_ERR;
+   }
+
+   /* G**X mod m */
+   if ((err = mp_exptmod(&g, X, &m, &y1)) != MP_OKAY)                goto LBL_ERR;
+
+   /* y1 + m * ((y2 - y1) * m**-1 mod 2**k) */
+   if ((err = mp_2expt(&g, k)) != MP_OKAY)                           goto LBL_ERR;
+   if ((err = mp_invmod(&m, &g, &t)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&y2, &y1, &y2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_mul(&y2, &t, &y2)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = mp_mod(&y2, &g, &y2)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = mp_mul(&y2, &m, &y2)) != MP_OKAY)                      goto LBL_ERR;
+   if ((err = mp_add(&y2, &y1, Y)) != MP_OKAY)                       goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear_multi(&g, &m, &y1, &y2, &t, NULL);
+   return err;
+}
+#endif
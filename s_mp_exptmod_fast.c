@@ -21,16 +21,25 @@
 
 mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode)
 {
-   mp_int  M[TAB_SIZE], res;
+   mp_int  M[TAB_SIZE], res, t;
    mp_digit buf, mp;
    int     bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
+   void    *mem;
+   size_t  size;
    mp_err   err;
 
    /* use a pointer to the reduction algorithm.  This allows us to use
     * one of many reduction algorithms without modding the guts of
     * the code with if statements everywhere.
     */
-   mp_err(*redux)(mp_int *x, const mp_int *n, mp_digit rho);
+   mp_redux_fn redux;
+   const mp_kernel_table *kernels = s_mp_kernels();
+
+   /* a special kernel for the host CPU, if any, handles the generic Montgomery case */
+   if ((redmode == 0) && (kernels->exptmod != NULL) &&
+       (mp_count_bits(P) >= kernels->exptmod_min_bits) && (mp_count_bits(P) <= kernels->exptmod_max_bits)) {
+      return kernels->exptmod(G, X, P, Y);
+   }
 
    /* find window size */
    x = mp_count_bits(X);
@@ -52,65 +61,17 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
 
    winsize = MAX_WINSIZE ? MP_MIN(MAX_WINSIZE, winsize) : winsize;
 
-   /* init M array */
-   /* init first cell */
-   if ((err = mp_init_size(&M[1], P->alloc)) != MP_OKAY) {
+   /* init M array, one allocation for all entries */
+   if ((err = s_mp_exptmod_table(M, winsize, P->used, &mem, &size)) != MP_OKAY) {
       return err;
    }
 
-   /* now init the second half of the array */
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      if ((err = mp_init_size(&M[x], P->alloc)) != MP_OKAY) {
-         for (y = 1<<(winsize-1); y < x; y++) {
-            mp_clear(&M[y]);
-         }
-         mp_clear(&M[1]);
-         return err;
-      }
-   }
-
    /* determine and setup reduction code */
-   if (redmode == 0) {
-      if (MP_HAS(MP_MONTGOMERY_SETUP)) {
-         /* now setup montgomery  */
-         if ((err = mp_montgomery_setup(P, &mp)) != MP_OKAY)      goto LBL_M;
-      } else {
-         err = MP_VAL;
-         goto LBL_M;
-      }
+   if ((err = s_mp_exptmod_setup(P, redmode, &redux, &mp)) != MP_OKAY) goto LBL_M;
 
-      /* automatically pick the comba one if available (saves quite a few calls/ifs) */
-      if (MP_HAS(S_MP_MONTGOMERY_REDUCE_COMBA) &&
-          (((P->used * 2) + 1) < MP_WARRAY) &&
-          (P->used < MP_MAX_COMBA)) {
-         redux = s_mp_montgomery_reduce_comba;
-      } else if (MP_HAS(MP_MONTGOMERY_REDUCE)) {
-         /* use slower baseline Montgomery method */
-         redux = mp_montgomery_reduce;
-      } else {
-         err = MP_VAL;
-         goto LBL_M;
-      }
-   } else if (redmode == 1) {
-      if (MP_HAS(MP_DR_SETUP) && MP_HAS(MP_DR_REDUCE)) {
-         /* setup DR reduction for moduli of the form B**k - b */
-         mp_dr_setup(P, &mp);
-         redux = mp_dr_reduce;
-      } else {
-         err = MP_VAL;
-         goto LBL_M;
-      }
-   } else if (MP_HAS(MP_REDUCE_2K_SETUP) && MP_HAS(MP_REDUCE_2K)) {
-      /* setup DR reduction for moduli of the form 2**k - b */
-      if ((err = mp_reduce_2k_setup(P, &mp)) != MP_OKAY)          goto LBL_M;
-      redux = mp_reduce_2k;
-   } else {
-      err = MP_VAL;
-      goto LBL_M;
-   }
-
-   /* setup result */
-   if ((err = mp_init_size(&res, P->alloc)) != MP_OKAY)           goto LBL_M;
+   /* setup the scratch the entries are computed in and the result */
+   if ((err = mp_init_size(&t, (2 * P->used) + 1)) != MP_OKAY)     goto LBL_M;
+   if ((err = mp_init_size(&res, P->alloc)) != MP_OKAY)           goto LBL_T;
 
    /* create M table
     *
@@ -125,28 +86,29 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
          if ((err = mp_montgomery_calc_normalization(&res, P)) != MP_OKAY) goto LBL_RES;
 
          /* now set M[1] to G * R mod m */
-         if ((err = mp_mulmod(G, &res, P, &M[1])) != MP_OKAY)     goto LBL_RES;
+         if ((err = mp_mulmod(G, &res, P, &t)) != MP_OKAY)        goto LBL_RES;
       } else {
          err = MP_VAL;
          goto LBL_RES;
       }
    } else {
       mp_set(&res, 1uL);
-      if ((err = mp_mod(G, P, &M[1])) != MP_OKAY)                 goto LBL_RES;
+      if ((err = mp_mod(G, P, &t)) != MP_OKAY)                    goto LBL_RES;
    }
+   if ((err = mp_copy(&t, &M[1])) != MP_OKAY)                     goto LBL_RES;
 
    /* compute the value at M[1<<(winsize-1)] by squaring M[1] (winsize-1) times */
-   if ((err = mp_copy(&M[1], &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_RES;
-
    for (x = 0; x < (winsize - 1); x++) {
-      if ((err = mp_sqr(&M[(size_t)1 << (winsize - 1)], &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_RES;
-      if ((err = redux(&M[(size_t)1 << (winsize - 1)], P, mp)) != MP_OKAY) goto LBL_RES;
+      if ((err = mp_sqr(&t, &t)) != MP_OKAY)                      goto LBL_RES;
+      if ((err = redux(&t, P, mp)) != MP_OKAY)                    goto LBL_RES;
    }
+   if ((err = mp_copy(&t, &M[(size_t)1 << (winsize - 1)])) != MP_OKAY) goto LBL_RES;
 
    /* create upper table */
    for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
-      if ((err = mp_mul(&M[x - 1], &M[1], &M[x])) != MP_OKAY)     goto LBL_RES;
-      if ((err = redux(&M[x], P, mp)) != MP_OKAY)                 goto LBL_RES;
+      if ((err = mp_mul(&M[x - 1], &M[1], &t)) != MP_OKAY)        goto LBL_RES;
+      if ((err = redux(&t, P, mp)) != MP_OKAY)                    goto LBL_RES;
+      if ((err = mp_copy(&t, &M[x])) != MP_OKAY)                  goto LBL_RES;
    }
 
    /* set initial mode and bit cnt */
@@ -244,11 +206,10 @@ mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_i
    err = MP_OKAY;
 LBL_RES:
    mp_clear(&res);
+LBL_T:
+   mp_clear(&t);
 LBL_M:
-   mp_clear(&M[1]);
-   for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
-      mp_clear(&M[x]);
-   }
+   MP_FREE_BUF(mem, size);
    return err;
 }
 #endif
@@ -0,0 +1,240 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_IFMA_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* computes Y == G**X mod P for odd P with AVX-512 IFMA
+ *
+ * The numbers are converted to limbs of 52 bits in 64 bit words, which is
+ * what the vpmadd52luq/vpmadd52huq instructions multiply.  Eight limbs are
+ * processed at once, the limb count is padded to a multiple of eight.
+ *
+ * The Montgomery multiplication is the "almost Montgomery multiplication"
+ * of Gueron and Krasnov: the word-serial reduction is interleaved with the
+ * multiplication, the lanes accumulate the partial products without carry
+ * propagation and are normalized once at the end.  With R > 4P all values
+ * stay below 2P and no conditional subtraction is needed until the very end.
+ *
+ *    Gueron, Shay, and Vlad Krasnov. "Accelerating Big Integer Arithmetic
+ *    Using Intel IFMA Extensions." 23rd IEEE Symposium on Computer
+ *    Arithmetic (ARITH'16). IEEE, 2016.
+ *
+ * Uses a left-to-right fixed window.
+ *
+ * The functions are compiled for the extension, s_mp_kernels() only picks
+ * them if the CPU has it.
+ */
+
+/* the intrinsics headers are not C89 clean, which -Wsystem-headers would report */
+#ifdef __GNUC__
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeclaration-after-statement"
+#endif
+#include <immintrin.h>
+#ifdef __GNUC__
+#   pragma GCC diagnostic pop
+#endif
+
+#define MP_IFMA_BITS 52
+#define MP_IFMA_MASK ((((uint64_t)1) << MP_IFMA_BITS) - 1u)
+#define MP_IFMA_LANES 8
+#define MP_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+/* 52 bits of |a| starting at bit off */
+static uint64_t s_ifma_get_limb(const mp_int *a, int off)
+{
+   int d = off / MP_DIGIT_BIT, s = off % MP_DIGIT_BIT, got = 0;
+   uint64_t r = 0u;
+   while ((got < MP_IFMA_BITS) && (d < a->used)) {
+      r |= ((uint64_t)(a->dp[d] >> s)) << got;
+      got += MP_DIGIT_BIT - s;
+      s = 0;
+      d++;
+   }
+   return r & MP_IFMA_MASK;
+}
+
+static void s_ifma_from_mp(const mp_int *a, uint64_t *r, int n)
+{
+   int i;
+   for (i = 0; i < n; i++) {
+      r[i] = s_ifma_get_limb(a, i * MP_IFMA_BITS);
+   }
+}
+
+static mp_err s_ifma_to_mp(const uint64_t *r, int n, mp_int *a)
+{
+   int i, oldused = a->used, digs = ((n * MP_IFMA_BITS) + (MP_DIGIT_BIT - 1)) / MP_DIGIT_BIT;
+   mp_err err;
+
+   if ((err = mp_grow(a, digs)) != MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < digs; i++) {
+      int off = i * MP_DIGIT_BIT, l = off / MP_IFMA_BITS, s = off % MP_IFMA_BITS, got = 0;
+      mp_digit d = 0u;
+      while ((got < MP_DIGIT_BIT) && (l < n)) {
+         d |= (mp_digit)((r[l] >> s) << got);
+         got += MP_IFMA_BITS - s;
+         s = 0;
+         l++;
+      }
+      a->dp[i] = d & MP_MASK;
+   }
+   a->used = digs;
+   a->sign = MP_ZPOS;
+   s_mp_zero_digs(a->dp + a->used, oldused - a->used);
+   mp_clamp(a);
+   return MP_OKAY;
+}
+
+/* r = a * b / 2**(52*n) mod m with a, b < 2m, result < 2m. r may alias a or b, acc is aligned */
+MP_IFMA_TARGET static void s_ifma_amm(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, uint64_t m0,
+                                      int n, uint64_t *acc)
+{
+   int i, j, v, nv = n / MP_IFMA_LANES;
+   uint64_t carry;
+   __m512i *A = (__m512i *)(void *)acc;
+
+   for (v = 0; v < nv; v++) {
+      A[v] = _mm512_setzero_si512();
+   }
+
+   for (i = 0; i < n; i++) {
+      __m512i bi = _mm512_set1_epi64((long long)b[i]), yi;
+      uint64_t a0, y;
+
+      /* low halves of a * b_i */
+      for (v = 0; v < nv; v++) {
+         A[v] = _mm512_madd52lo_epu64(A[v], _mm512_loadu_si512((const void *)(a + (v * MP_IFMA_LANES))), bi);
+      }
+
+      /* y = acc_0 * -1/m mod 2**52 zeroes the lowest limb */
+      a0 = (uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(A[0]));
+      y = (a0 * m0) & MP_IFMA_MASK;
+      yi = _mm512_set1_epi64((long long)y);
+      carry = (a0 + ((y * m[0]) & MP_IFMA_MASK)) >> MP_IFMA_BITS;
+
+      /* low halves of m * y */
+      for (v = 0; v < nv; v++) {
+         A[v] = _mm512_madd52lo_epu64(A[v], _mm512_loadu_si512((const void *)(m + (v * MP_IFMA_LANES))), yi);
+      }
+
+      /* shift down by one limb, the carry of the lowest limb goes into the next one */
+      for (v = 0; v < (nv - 1); v++) {
+         A[v] = _mm512_alignr_epi64(A[v + 1], A[v], 1);
+      }
+      A[nv - 1] = _mm512_alignr_epi64(_mm512_setzero_si512(), A[nv - 1], 1);
+      A[0] = _mm512_add_epi64(A[0], _mm512_maskz_set1_epi64((__mmask8)1, (long long)carry));
+
+      /* the high halves belong one limb up, that is where they are after the shift */
+      for (v = 0; v < nv; v++) {
+         A[v] = _mm512_madd52hi_epu64(A[v], _mm512_loadu_si512((const void *)(a + (v * MP_IFMA_LANES))), bi);
+         A[v] = _mm512_madd52hi_epu64(A[v], _mm512_loadu_si512((const void *)(m + (v * MP_IFMA_LANES))), yi);
+      }
+   }
+
+   /* normalize to 52 bit limbs */
+   carry = 0u;
+   for (j = 0; j < n; j++) {
+      uint64_t t = acc[j] + carry;
+      r[j] = t & MP_IFMA_MASK;
+      carry = t >> MP_IFMA_BITS;
+   }
+}
+
+MP_IFMA_TARGET mp_err s_mp_exptmod_ifma(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y)
+{
+   int n, i, j, x, winsize, bits;
+   uint64_t *buf, *base, *m, *acc, *res, *rr, *tab, m0;
+   size_t size;
+   mp_int t;
+   mp_err err;
+
+   /* limb count such that R = 2**(52*n) > 4P */
+   n = (mp_count_bits(P) + 2 + (MP_IFMA_BITS - 1)) / MP_IFMA_BITS;
+   n = (n + (MP_IFMA_LANES - 1)) & ~(MP_IFMA_LANES - 1);
+
+   bits = mp_count_bits(X);
+   winsize = (bits <= 36) ? 3 : ((bits <= 140) ? 4 : ((bits <= 450) ? 5 : 6));
+
+   /* accumulator, modulus, result, R**2 and the table, aligned to 64 bytes */
+   size = (sizeof(uint64_t) * (size_t)n * (4u + ((size_t)1 << winsize))) + 64u;
+   buf = (uint64_t *) MP_MALLOC(size);
+   if (buf == NULL) {
+      return MP_MEM;
+   }
+   base = (uint64_t *)(void *)(((uintptr_t)buf + 63u) & ~(uintptr_t)63u);
+   acc = base;
+   m = acc + n;
+   res = m + n;
+   rr = res + n;
+   tab = rr + n;
+
+   if ((err = mp_init(&t)) != MP_OKAY) {
+      goto LBL_BUF;
+   }
+
+   /* -1/P mod 2**52 */
+   s_ifma_from_mp(P, m, n);
+   m0 = m[0];
+   for (i = 0; i < 5; i++) {
+      m0 *= 2u - (m[0] * m0);
+   }
+   m0 = (0u - m0) & MP_IFMA_MASK;
+
+   /* tab[0] = R mod P, tab[1] = G * R mod P */
+   if ((err = mp_2expt(&t, 2 * MP_IFMA_BITS * n)) != MP_OKAY)     goto LBL_T;
+   if ((err = mp_mod(&t, P, &t)) != MP_OKAY)                       goto LBL_T;
+   s_ifma_from_mp(&t, rr, n);
+   if ((err = mp_mod(G, P, &t)) != MP_OKAY)                        goto LBL_T;
+   s_ifma_from_mp(&t, res, n);
+   s_ifma_amm(tab + n, res, rr, m, m0, n, acc);
+   s_mp_zero_buf(res, sizeof(uint64_t) * (size_t)n);
+   res[0] = 1u;
+   s_ifma_amm(tab, res, rr, m, m0, n, acc);
+   for (j = 2; j < (1 << winsize); j++) {
+      s_ifma_amm(tab + (j * n), tab + ((j - 1) * n), tab + n, m, m0, n, acc);
+   }
+
+   /* left-to-right fixed window, the first window is copied from the table */
+   for (j = 0; j < n; j++) {
+      res[j] = tab[j];
+   }
+   for (i = ((bits + (winsize - 1)) / winsize) - 1; i >= 0; i--) {
+      x = 0;
+      for (j = winsize - 1; j >= 0; j--) {
+         x = (x << 1) | (s_mp_get_bit(X, (i * winsize) + j) ? 1 : 0);
+      }
+      if (i == (((bits + (winsize - 1)) / winsize) - 1)) {
+         for (j = 0; j < n; j++) {
+            res[j] = tab[(x * n) + j];
+         }
+         continue;
+      }
+      for (j = 0; j < winsize; j++) {
+         s_ifma_amm(res, res, res, m, m0, n, acc);
+      }
+      if (x != 0) {
+         s_ifma_amm(res, res, tab + (x * n), m, m0, n, acc);
+      }
+   }
+
+   /* leave the Montgomery domain, the result is below 2P */
+   s_mp_zero_buf(rr, sizeof(uint64_t) * (size_t)n);
+   rr[0] = 1u;
+   s_ifma_amm(res, res, rr, m, m0, n, acc);
+   if ((err = s_ifma_to_mp(res, n, &t)) != MP_OKAY)                goto LBL_T;
+   if (mp_cmp_mag(&t, P) != MP_LT) {
+      if ((err = s_mp_sub(&t, P, &t)) != MP_OKAY)                  goto LBL_T;
+   }
+   mp_exch(&t, Y);
+
+LBL_T:
+   mp_clear(&t);
+LBL_BUF:
+   MP_FREE_BUF(buf, size);
+   return err;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_SETUP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* picks the reduction for redmode [0 Montgomery, 1 DR, 2 for 2**k - b,
+ * 3 for the primes of mp_reduce_special] and computes its constant, shared
+ * by the exponentiations built on a single digit reduction like
+ * s_mp_exptmod_fast
+ */
+mp_err s_mp_exptmod_setup(const mp_int *P, int redmode, mp_redux_fn *redux, mp_digit *rho)
+{
+   mp_err err;
+
+   if (redmode == 0) {
+      if (!MP_HAS(MP_MONTGOMERY_SETUP)) {
+         return MP_VAL;
+      }
+      /* now setup montgomery  */
+      if ((err = mp_montgomery_setup(P, rho)) != MP_OKAY) {
+         return err;
+      }
+
+      /* automatically pick the comba one if available (saves quite a few calls/ifs) */
+      if (MP_HAS(S_MP_MONTGOMERY_REDUCE_COMBA) &&
+          (((P->used * 2) + 1) < MP_WARRAY) &&
+          (P->used < MP_MAX_COMBA)) {
+         *redux = s_mp_montgomery_reduce_comba;
+      } else if (MP_HAS(MP_MONTGOMERY_REDUCE)) {
+         /* use slower baseline Montgomery method */
+         *redux = mp_montgomery_reduce;
+      } else {
+         return MP_VAL;
+      }
+   } else if (redmode == 1) {
+      if (!MP_HAS(MP_DR_SETUP) || !MP_HAS(MP_DR_REDUCE)) {
+         return MP_VAL;
+      }
+      /* setup DR reduction for moduli of the form B**k - b */
+      mp_dr_setup(P, rho);
+      *redux = mp_dr_reduce;
+   } else if (redmode == 2) {
+      if (!MP_HAS(MP_REDUCE_2K_SETUP) || !MP_HAS(MP_REDUCE_2K)) {
+         return MP_VAL;
+      }
+      /* setup DR reduction for moduli of the form 2**k - b */
+      if ((err = mp_reduce_2k_setup(P, rho)) != MP_OKAY) {
+         return err;
+      }
+      *redux = mp_reduce_2k;
+   } else {
+      if (!MP_HAS(MP_REDUCE_SPECIAL_SETUP) || !MP_HAS(MP_REDUCE_SPECIAL)) {
+         return MP_VAL;
+      }
+      /* setup the reduction of its own of one of the special primes */
+      if ((err = mp_reduce_special_setup(P, rho)) != MP_OKAY) {
+         return err;
+      }
+      *redux = mp_reduce_special;
+   }
+   return MP_OKAY;
+}
+#endif
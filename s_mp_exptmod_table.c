@@ -0,0 +1,45 @@
+#include "tommath_private.h"
+#ifdef S_MP_EXPTMOD_TABLE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* points M[1] and M[2**(winsize-1)] to M[2**winsize - 1], the entries of the
+ * sliding window tables of s_mp_exptmod and s_mp_exptmod_fast, to rows of
+ * one allocation instead of allocating every entry on its own.
+ *
+ * Every row has room for digits digits and starts on a cache line.  The
+ * entries must only be written by mp_copy of values of at most digits
+ * digits, nothing may grow, clear or exchange them.  The whole table is
+ * freed with MP_FREE_BUF(*mem, *size).
+ */
+
+#define MP_TABLE_LINE_DIGITS ((int)(64u / sizeof(mp_digit)))
+
+mp_err s_mp_exptmod_table(mp_int *M, int winsize, int digits, void **mem, size_t *size)
+{
+   mp_digit *base;
+   int x, stride, rows;
+
+   stride = ((MP_MAX(digits, 1) + MP_TABLE_LINE_DIGITS - 1) / MP_TABLE_LINE_DIGITS) * MP_TABLE_LINE_DIGITS;
+   rows = 1 + (1 << (winsize - 1));
+   *size = (sizeof(mp_digit) * (size_t)stride * (size_t)rows) + 64u;
+   *mem = MP_CALLOC(1u, *size);
+   if (*mem == NULL) {
+      return MP_MEM;
+   }
+   base = (mp_digit *)(void *)(((uintptr_t)*mem + 63u) & ~(uintptr_t)63u);
+
+   M[1].dp = base;
+   M[1].used = 0;
+   M[1].alloc = stride;
+   M[1].sign = MP_ZPOS;
+   for (x = 1 << (winsize - 1); x < (1 << winsize); x++) {
+      base += stride;
+      M[x].dp = base;
+      M[x].used = 0;
+      M[x].alloc = stride;
+      M[x].sign = MP_ZPOS;
+   }
+   return MP_OKAY;
+}
+#endif
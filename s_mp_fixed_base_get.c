@@ -0,0 +1,21 @@
+#include "tommath_private.h"
+#ifdef S_MP_FIXED_BASE_GET_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* a = table entry i */
+mp_err s_mp_fixed_base_get(const mp_fixed_base *fb, int i, mp_int *a)
+{
+   mp_err err;
+
+   if ((err = mp_grow(a, fb->width)) != MP_OKAY) {
+      return err;
+   }
+   s_mp_copy_digs(a->dp, fb->tab + ((size_t)i * (size_t)fb->width), fb->width);
+   s_mp_zero_digs(a->dp + fb->width, a->used - fb->width);
+   a->used = fb->width;
+   a->sign = MP_ZPOS;
+   mp_clamp(a);
+   return MP_OKAY;
+}
+#endif
@@ -0,0 +1,13 @@
+#include "tommath_private.h"
+#ifdef S_MP_FIXED_BASE_SET_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* table entry i = a, 0 <= a < P */
+void s_mp_fixed_base_set(mp_fixed_base *fb, int i, const mp_int *a)
+{
+   mp_digit *d = fb->tab + ((size_t)i * (size_t)fb->width);
+   s_mp_copy_digs(d, a->dp, a->used);
+   s_mp_zero_digs(d + a->used, fb->width - a->used);
+}
+#endif
@@ -0,0 +1,62 @@
+#include "tommath_private.h"
+#ifdef S_MP_KERNELS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* portable C */
+static const mp_kernel_table s_kernels_generic = {
+   NULL, 0, 0,
+   NULL, 0,
+   { "generic", "generic" }
+};
+
+/* AVX2 */
+static const mp_kernel_table s_kernels_avx2 = {
+   NULL, 0, 0,
+   MP_HAS(S_MP_EXPTMOD4_AVX2) ? s_mp_exptmod4_avx2 : NULL, MP_AVX2_MAX_BITS,
+   { "generic", "avx2" }
+};
+
+/* AVX-512 IFMA */
+static const mp_kernel_table s_kernels_ifma = {
+   MP_HAS(S_MP_EXPTMOD_IFMA) ? s_mp_exptmod_ifma : NULL, MP_IFMA_MIN_BITS, MP_IFMA_MAX_BITS,
+   MP_HAS(S_MP_EXPTMOD4_AVX2) ? s_mp_exptmod4_avx2 : NULL, MP_AVX2_IFMA_BITS,
+   { "avx512ifma", "avx2" }
+};
+
+static const mp_kernel_table *s_kernels = NULL;
+
+/* The tables are constant, only the pointer to the chosen one is shared.  It is
+ * accessed atomically where the compiler has the builtins for it.  Otherwise two
+ * threads which use the library for the first time race on it, s_mp_parallel
+ * calls s_mp_kernels before it starts its threads so that its workers only read it.
+ */
+#ifdef __ATOMIC_RELAXED
+#define s_kernels_load()   __atomic_load_n(&s_kernels, __ATOMIC_RELAXED)
+#define s_kernels_store(k) __atomic_store_n(&s_kernels, (k), __ATOMIC_RELAXED)
+#else
+#define s_kernels_load()   s_kernels
+#define s_kernels_store(k) (s_kernels = (k))
+#endif
+
+/* the kernels are chosen at the first use */
+const mp_kernel_table *s_mp_kernels(void)
+{
+   const mp_kernel_table *k = s_kernels_load();
+   if (k == NULL) {
+      unsigned int f = MP_HAS(MP_CPU_FEATURES) ? mp_cpu_features() : 0u;
+      k = &s_kernels_generic;
+      if (MP_HAS(S_MP_EXPTMOD_IFMA) &&
+          ((f & (MP_CPU_AVX512F | MP_CPU_AVX512IFMA)) == (MP_CPU_AVX512F | MP_CPU_AVX512IFMA))) {
+         k = &s_kernels_ifma;
+      } else if (MP_HAS(S_MP_EXPTMOD4_AVX2) && ((f & MP_CPU_AVX2) != 0u)) {
+         k = &s_kernels_avx2;
+      }
+      s_kernels_store(k);
+   }
+   return k;
+}
+
+#undef s_kernels_load
+#undef s_kernels_store
+#endif
@@ -9,13 +9,20 @@
  * which uses the comba method to quickly calculate the columns of the
  * reduction.
  *
+ * The columns are computed one after the other (product scanning) with
+ * a single double precision accumulator, the carry is propagated from
+ * column to column like in s_mp_mul_comba.  The digits mu_i of the
+ * multiplier are stored in place of the digits of x that have been
+ * consumed, and the digits of the result in place of the mu_i that are
+ * not needed anymore, so no temporary array is necessary.
+ *
  * Based on Algorithm 14.32 on pp.601 of HAC.
 */
 mp_err s_mp_montgomery_reduce_comba(mp_int *x, const mp_int *n, mp_digit rho)
 {
-   int     ix, oldused;
-   mp_err  err;
-   mp_word W[MP_WARRAY];
+   int      ix, oldused, digs;
+   mp_err   err;
+   mp_word  _W;
 
    if (x->used > MP_WARRAY) {
       return MP_VAL;
@@ -23,82 +30,52 @@ mp_err s_mp_montgomery_reduce_comba(mp_int *x, const mp_int *n, mp_digit rho)
 
    /* get old used count */
    oldused = x->used;
+   digs = (n->used * 2) + 1;
 
-   /* grow a as required */
-   if ((err = mp_grow(x, n->used + 1)) != MP_OKAY) {
+   /* grow a as required and clear the digits up to 2*n->used */
+   if ((err = mp_grow(x, digs)) != MP_OKAY) {
       return err;
    }
-
-   /* first we have to get the digits of the input into
-    * an array of double precision words W[...]
-    */
-
-   /* copy the digits of a into W[0..a->used-1] */
-   for (ix = 0; ix < x->used; ix++) {
-      W[ix] = x->dp[ix];
+   if (x->used < digs) {
+      s_mp_zero_digs(x->dp + x->used, digs - x->used);
    }
 
-   /* zero the high words of W[a->used..m->used*2] */
-   if (ix < ((n->used * 2) + 1)) {
-      s_mp_zero_buf(W + x->used, sizeof(mp_word) * (size_t)(((n->used * 2) + 1) - ix));
-   }
-
-   /* now we proceed to zero successive digits
-    * from the least significant upwards
-    */
+   /* the lower half: the columns 0..n->used-1 where the mu_i are computed */
+   _W = 0;
    for (ix = 0; ix < n->used; ix++) {
       int iy;
       mp_digit mu;
 
-      /* mu = ai * m' mod b
-       *
-       * We avoid a double precision multiplication (which isn't required)
-       * by casting the value down to a mp_digit.  Note this requires
-       * that W[ix-1] have  the carry cleared (see after the inner loop)
-       */
-      mu = ((W[ix] & MP_MASK) * rho) & MP_MASK;
-
-      /* a = a + mu * m * b**i
-       *
-       * This is computed in place and on the fly.  The multiplication
-       * by b**i is handled by offseting which columns the results
-       * are added to.
-       *
-       * Note the comba method normally doesn't handle carries in the
-       * inner loop In this case we fix the carry from the previous
-       * column since the Montgomery reduction requires digits of the
-       * result (so far) [see above] to work.  This is
-       * handled by fixing up one carry after the inner loop.  The
-       * carry fixups are done in order so after these loops the
-       * first m->used words of W[] have the carries fixed
-       */
-      for (iy = 0; iy < n->used; iy++) {
-         W[ix + iy] += (mp_word)mu * (mp_word)n->dp[iy];
+      /* add the products mu_j * n_(ix-j) that fall into this column */
+      _W += (mp_word)x->dp[ix];
+      for (iy = 0; iy < ix; iy++) {
+         _W += (mp_word)x->dp[iy] * (mp_word)n->dp[ix - iy];
       }
 
-      /* now fix carry for next digit, W[ix+1] */
-      W[ix + 1] += W[ix] >> (mp_word)MP_DIGIT_BIT;
+      /* mu = ai * m' mod b, which zeroes the column */
+      mu = ((mp_digit)_W * rho) & MP_MASK;
+      _W += (mp_word)mu * (mp_word)n->dp[0];
+      x->dp[ix] = mu;
+
+      /* make next carry */
+      _W = _W >> (mp_word)MP_DIGIT_BIT;
    }
 
-   /* now we have to propagate the carries and
-    * shift the words downward [all those least
-    * significant digits we zeroed].
+   /* the upper half: the columns n->used..2*n->used-1 are the result
+    * A/b**n, digit ix - n->used is stored where mu_(ix - n->used) was
     */
-
    for (; ix < (n->used * 2); ix++) {
-      W[ix + 1] += W[ix] >> (mp_word)MP_DIGIT_BIT;
-   }
+      int iy;
 
-   /* copy out, A = A/b**n
-    *
-    * The result is A/b**n but instead of converting from an
-    * array of mp_word to mp_digit than calling mp_rshd
-    * we just copy them in the right order
-    */
+      _W += (mp_word)x->dp[ix];
+      for (iy = (ix - n->used) + 1; iy < n->used; iy++) {
+         _W += (mp_word)x->dp[iy] * (mp_word)n->dp[ix - iy];
+      }
 
-   for (ix = 0; ix < (n->used + 1); ix++) {
-      x->dp[ix] = W[n->used + ix] & (mp_word)MP_MASK;
+      x->dp[ix - n->used] = (mp_digit)_W & MP_MASK;
+      _W = _W >> (mp_word)MP_DIGIT_BIT;
    }
+   x->dp[n->used] = (mp_digit)(_W + (mp_word)x->dp[n->used * 2]) & MP_MASK;
 
    /* set the max used */
    x->used = n->used + 1;
@@ -106,7 +83,7 @@ mp_err s_mp_montgomery_reduce_comba(mp_int *x, const mp_int *n, mp_digit rho)
    /* zero oldused digits, if the input a was larger than
     * m->used+1 we'll have to clear the digits
     */
-   s_mp_zero_digs(x->dp + x->used, oldused - x->used);
+   s_mp_zero_digs(x->dp + x->used, MP_MAX(oldused, digs) - x->used);
 
    mp_clamp(x);
 
@@ -0,0 +1,250 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_FFT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplication using a three-prime number theoretic transform (NTT)
+ *
+ * The inputs are cut into coefficients of MP_FFT_BITS bits which are
+ * convolved modulo three primes of the form k*2^n+1, all smaller than 2^31.
+ * Their product is about 2^90, large enough to hold every coefficient of
+ * the product exactly as long as the transform length does not exceed
+ * 2^MP_FFT_MAX_LOG. The coefficients are recovered with Garner's algorithm
+ * and the carries are propagated while writing the result.
+ *
+ * It runs in O(N log N) but the constant is large, it only pays off for
+ * inputs with several thousand digits.
+ *
+ * If a == b only one forward transform per prime is computed (squaring).
+ */
+
+#define MP_FFT_PRIMES 3
+
+/* the primes and a primitive root of each one */
+static const uint32_t s_fft_prime[MP_FFT_PRIMES] = { 2013265921u, 1811939329u, 469762049u };
+static const uint32_t s_fft_root[MP_FFT_PRIMES] = { 31u, 13u, 3u };
+
+/* Montgomery reduction of x < p * 2^32 with pn = -1/p mod 2^32: returns x / 2^32 mod p */
+static uint32_t s_redc(uint64_t x, uint32_t p, uint32_t pn)
+{
+   uint32_t m = (uint32_t)x * pn, r = (uint32_t)((x + ((uint64_t)m * p)) >> 32);
+   return (r >= p) ? (r - p) : r;
+}
+
+/* a * b / 2^32 mod p, either factor may be up to 2^32 - 1 if the other one is below p */
+static uint32_t s_mulmod(uint32_t a, uint32_t b, uint32_t p, uint32_t pn)
+{
+   return s_redc((uint64_t)a * b, p, pn);
+}
+
+/* a^e * 2^32 mod p for a in Montgomery form */
+static uint32_t s_powmod(uint32_t a, uint32_t e, uint32_t p, uint32_t pn)
+{
+   uint32_t r = (uint32_t)((((uint64_t)1) << 32) % p);
+   while (e != 0u) {
+      if ((e & 1u) != 0u) {
+         r = s_mulmod(r, a, p, pn);
+      }
+      a = s_mulmod(a, a, p, pn);
+      e >>= 1;
+   }
+   return r;
+}
+
+/* x * 2^32 mod p */
+static uint32_t s_to_mont(uint32_t x, uint32_t p)
+{
+   return (uint32_t)((((uint64_t)x) << 32) % p);
+}
+
+/* -1/p mod 2^32 */
+static uint32_t s_mont_setup(uint32_t p)
+{
+   uint32_t x = p;
+   x *= 2u - (p * x);
+   x *= 2u - (p * x);
+   x *= 2u - (p * x);
+   x *= 2u - (p * x);
+   return 0u - x;
+}
+
+/* Twiddle factors in Montgomery form, stored such that rt[h + j] = w_(2h)^j
+ * for the transform stage of half size h and w a primitive len-th root of unity.
+ * Each stage reads its factors in order.
+ */
+static void s_fft_roots(uint32_t *rt, int len, uint32_t w, uint32_t p, uint32_t pn)
+{
+   int h, j;
+   uint32_t x = s_to_mont(1u, p);
+   for (j = 0; j < (len / 2); j++) {
+      rt[(len / 2) + j] = x;
+      x = s_mulmod(x, w, p, pn);
+   }
+   for (h = len / 4; h >= 1; h /= 2) {
+      for (j = 0; j < h; j++) {
+         rt[h + j] = rt[(2 * h) + (2 * j)];
+      }
+   }
+}
+
+/* split |a| into coefficients reduced modulo p and pad with zeros */
+static void s_fft_load(const mp_int *a, uint32_t *t, int len, uint32_t p)
+{
+   int i, j, k = 0;
+   for (i = 0; i < a->used; i++) {
+      mp_digit d = a->dp[i];
+      for (j = 0; j < MP_FFT_PER_DIGIT; j++) {
+         uint32_t x = (uint32_t)(d & MP_FFT_MASK);
+         t[k++] = (x >= p) ? (x % p) : x;
+         d >>= ((MP_FFT_PER_DIGIT == 1) ? 0 : MP_FFT_BITS);
+      }
+   }
+   while (k < len) {
+      t[k++] = 0u;
+   }
+}
+
+/* forward transform, decimation in frequency: natural order in, bit-reversed order out */
+static void s_fft_forward(uint32_t *t, int len, const uint32_t *rt, uint32_t p, uint32_t pn)
+{
+   int h, i, j;
+   for (h = len / 2; h >= 1; h /= 2) {
+      for (i = 0; i < len; i += 2 * h) {
+         for (j = 0; j < h; j++) {
+            uint32_t u = t[i + j], v = t[i + j + h], x = u + v;
+            t[i + j] = (x >= p) ? (x - p) : x;
+            t[i + j + h] = s_mulmod((u + p) - v, rt[h + j], p, pn);
+         }
+      }
+   }
+}
+
+/* inverse transform without scaling, decimation in time: bit-reversed order in, natural order out */
+static void s_fft_inverse(uint32_t *t, int len, const uint32_t *rt, uint32_t p, uint32_t pn)
+{
+   int h, i, j;
+   for (h = 1; h < len; h *= 2) {
+      for (i = 0; i < len; i += 2 * h) {
+         for (j = 0; j < h; j++) {
+            uint32_t u = t[i + j], v = s_mulmod(t[i + j + h], rt[h + j], p, pn), x = u + v;
+            t[i + j] = (x >= p) ? (x - p) : x;
+            t[i + j + h] = (u >= v) ? (u - v) : ((u + p) - v);
+         }
+      }
+   }
+}
+
+mp_err s_mp_mul_fft(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   int lg, len, n, k, ix, oldused, used;
+   uint32_t *buf, *u, *rt, w[3];
+   uint32_t p0 = s_fft_prime[0], p1 = s_fft_prime[1], p2 = s_fft_prime[2], pn1, pn2, i01, i012, rr2, p0rr2;
+   uint64_t p01;
+   size_t size;
+   bool sqr = (a == b);
+   mp_err err;
+
+   /* number of coefficients of the product */
+   used = a->used + b->used;
+   n = (used * MP_FFT_PER_DIGIT) - 1;
+   for (lg = 0; (1 << lg) < n; lg++) {}
+   if (lg > MP_FFT_MAX_LOG) {
+      return MP_OVF;
+   }
+   len = 1 << lg;
+
+   /* three residue vectors, one scratch vector for b and the twiddle factors */
+   size = sizeof(uint32_t) * (size_t)len * 5u;
+   buf = (uint32_t *) MP_MALLOC(size);
+   if (buf == NULL) {
+      return MP_MEM;
+   }
+   u = buf + (3 * len);
+   rt = buf + (4 * len);
+
+   for (k = 0; k < MP_FFT_PRIMES; k++) {
+      uint32_t p = s_fft_prime[k], pn = s_mont_setup(p), g = s_to_mont(s_fft_root[k], p),
+               *t = buf + (k * len), *v = sqr ? t : u, ninv;
+
+      /* forward transforms */
+      s_fft_roots(rt, len, s_powmod(g, (p - 1u) >> lg, p, pn), p, pn);
+      s_fft_load(a, t, len, p);
+      s_fft_forward(t, len, rt, p, pn);
+      if (!sqr) {
+         s_fft_load(b, u, len, p);
+         s_fft_forward(u, len, rt, p, pn);
+      }
+
+      /* pointwise products, scaled by 1/len for the inverse transform */
+      ninv = s_to_mont(s_to_mont(p - ((p - 1u) >> lg), p), p);
+      for (ix = 0; ix < len; ix++) {
+         t[ix] = s_mulmod(s_mulmod(t[ix], v[ix], p, pn), ninv, p, pn);
+      }
+
+      /* inverse transform with the inverse roots */
+      s_fft_roots(rt, len, s_powmod(g, (p - 1u) - ((p - 1u) >> lg), p, pn), p, pn);
+      s_fft_inverse(t, len, rt, p, pn);
+   }
+
+   /* a and b may alias c, they are not needed anymore */
+   if ((err = mp_grow(c, used)) != MP_OKAY) {
+      goto LBL_ERR;
+   }
+
+   /* Garner: x = r0 + p0 * t1 + p0 * p1 * t2 with t1 < p1 and t2 < p2 */
+   pn1 = s_mont_setup(p1);
+   pn2 = s_mont_setup(p2);
+   i01 = s_powmod(s_to_mont(p0 % p1, p1), p1 - 2u, p1, pn1);
+   p01 = (uint64_t)p0 * p1;
+   i012 = s_redc(s_powmod(s_to_mont((uint32_t)(p01 % p2), p2), p2 - 2u, p2, pn2), p2, pn2);
+   rr2 = s_to_mont(s_to_mont(1u, p2), p2);
+   p0rr2 = s_to_mont(s_to_mont(p0 % p2, p2), p2);
+
+   /* w is a 96 bit carry in 32 bit limbs */
+   w[0] = w[1] = w[2] = 0u;
+   for (ix = 0; ix < used; ix++) {
+      mp_digit d = 0u;
+      int j;
+      for (j = 0; j < MP_FFT_PER_DIGIT; j++) {
+         k = (ix * MP_FFT_PER_DIGIT) + j;
+         if (k < n) {
+            uint32_t r0 = buf[k], r1 = buf[len + k], r2 = buf[(2 * len) + k], t1, t2, y2;
+            uint64_t y, m0, m1;
+
+            /* t1 = (r1 - r0) / p0 mod p1, note that p0 < 2 * p1 */
+            t2 = (r0 >= p1) ? (r0 - p1) : r0;
+            t1 = s_mulmod((r1 >= t2) ? (r1 - t2) : ((r1 + p1) - t2), i01, p1, pn1);
+            y = (uint64_t)r0 + ((uint64_t)p0 * t1);
+
+            /* t2 = (r2 - y) / (p0 * p1) mod p2, computed in Montgomery form */
+            y2 = s_mulmod(r0, rr2, p2, pn2) + s_mulmod(t1, p0rr2, p2, pn2);
+            y2 = (y2 >= p2) ? (y2 - p2) : y2;
+            t2 = s_mulmod(r2, rr2, p2, pn2);
+            t2 = s_mulmod((t2 >= y2) ? (t2 - y2) : ((t2 + p2) - y2), i012, p2, pn2);
+
+            /* w += y + p01 * t2 */
+            m0 = ((p01 & 0xFFFFFFFFu) * t2) + (y & 0xFFFFFFFFu) + w[0];
+            m1 = ((p01 >> 32) * t2) + (y >> 32) + w[1] + (m0 >> 32);
+            w[0] = (uint32_t)m0;
+            w[1] = (uint32_t)m1;
+            w[2] += (uint32_t)(m1 >> 32);
+         }
+         d |= ((mp_digit)w[0] & MP_FFT_MASK) << (j * MP_FFT_BITS);
+         w[0] = (uint32_t)(((((uint64_t)w[1]) << 32) | w[0]) >> MP_FFT_BITS);
+         w[1] = (uint32_t)(((((uint64_t)w[2]) << 32) | w[1]) >> MP_FFT_BITS);
+         w[2] = (uint32_t)(((uint64_t)w[2]) >> MP_FFT_BITS);
+      }
+      c->dp[ix] = d;
+   }
+
+   oldused = c->used;
+   c->used = used;
+   c->sign = MP_ZPOS;
+   s_mp_zero_digs(c->dp + c->used, oldused - c->used);
+   mp_clamp(c);
+
+LBL_ERR:
+   MP_FREE_BUF(buf, size);
+   return err;
+}
+#endif
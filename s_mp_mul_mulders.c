@@ -0,0 +1,80 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_MULDERS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* c = |a| * |b| mod B**n with Mulders' short product
+ *
+ * Let k >= n/2 and
+ *
+ * a = a1 * B**k + a0
+ * b = b1 * B**k + b0
+ *
+ * Then, mod B**n, as 2k >= n
+ *
+ * a * b = a0b0 + (a1b0 + a0b1 mod B**(n-k)) * B**k
+ *
+ * a0b0 is a full product of k digits, the others are short products of
+ * n-k digits again.  With k = n/2 this saves nothing over the full product
+ * with Karatsuba, k of about 0.7n leaves about 0.8 of its work, less with
+ * Toom-Cook where the full products are cheaper.  For a == b the two short
+ * products are the same.
+ */
+
+/* a = the digits lo to hi-1 of b */
+static mp_err s_digits(const mp_int *b, int lo, int hi, mp_int *a)
+{
+   mp_err err;
+   hi = MP_MIN(hi, b->used);
+   if (hi <= lo) {
+      mp_zero(a);
+      return MP_OKAY;
+   }
+   if ((err = mp_grow(a, hi - lo)) != MP_OKAY) {
+      return err;
+   }
+   s_mp_copy_digs(a->dp, b->dp + lo, hi - lo);
+   a->used = hi - lo;
+   a->sign = MP_ZPOS;
+   mp_clamp(a);
+   return MP_OKAY;
+}
+
+mp_err s_mp_mul_mulders(const mp_int *a, const mp_int *b, mp_int *c, int n)
+{
+   mp_int a0, a1, b0, b1, t, u;
+   int k = n - ((3 * n) / 10);
+   mp_err err;
+
+   if ((err = mp_init_multi(&a0, &a1, &b0, &b1, &t, &u, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   if ((err = s_digits(a, 0, k, &a0)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = s_digits(a, k, n, &a1)) != MP_OKAY)                     goto LBL_ERR;
+   if (a == b) {
+      /* t = 2 * a1a0 */
+      if ((err = mp_mul_low(&a1, &a0, n - k, &t)) != MP_OKAY)        goto LBL_ERR;
+      if ((err = mp_mul_2(&t, &t)) != MP_OKAY)                        goto LBL_ERR;
+      if ((err = mp_sqr(&a0, &u)) != MP_OKAY)                         goto LBL_ERR;
+   } else {
+      /* t = a1b0 + a0b1 */
+      if ((err = s_digits(b, 0, k, &b0)) != MP_OKAY)                  goto LBL_ERR;
+      if ((err = s_digits(b, k, n, &b1)) != MP_OKAY)                  goto LBL_ERR;
+      if ((err = mp_mul_low(&a1, &b0, n - k, &t)) != MP_OKAY)        goto LBL_ERR;
+      if ((err = mp_mul_low(&a0, &b1, n - k, &u)) != MP_OKAY)        goto LBL_ERR;
+      if ((err = s_mp_add(&t, &u, &t)) != MP_OKAY)                    goto LBL_ERR;
+      if ((err = mp_mul(&a0, &b0, &u)) != MP_OKAY)                    goto LBL_ERR;
+   }
+
+   /* c = a0b0 + t * B**k mod B**n */
+   if ((err = mp_mod_2d(&t, (n - k) * MP_DIGIT_BIT, &t)) != MP_OKAY) goto LBL_ERR;
+   if ((err = mp_lshd(&t, k)) != MP_OKAY)                             goto LBL_ERR;
+   if ((err = s_mp_add(&t, &u, c)) != MP_OKAY)                        goto LBL_ERR;
+   err = mp_mod_2d(c, n * MP_DIGIT_BIT, c);
+
+LBL_ERR:
+   mp_clear_multi(&a0, &a1, &b0, &b1, &t, &u, NULL);
+   return err;
+}
+#endif
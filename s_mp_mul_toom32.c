@@ -0,0 +1,114 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM32_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* unbalanced multiplication using the Toom-Cook 3/2 algorithm
+ *
+ * The larger input is split into three parts and the smaller one into
+ * two parts of the same size, the product is a polynomial of degree
+ * three evaluated at 0, 1, -1 and infinity.  That are four
+ * multiplications for inputs with a size ratio of about 3:2 where
+ * Karatsuba on the smaller size would need more and slicing in
+ * s_mp_mul_balance would need two full multiplications.
+*/
+mp_err s_mp_mul_toom32(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int S1, S2, T1, a0, a1, a2, b0, b1;
+   int B;
+   mp_err err;
+
+   /* Make sure that a is the larger one */
+   if (a->used < b->used) {
+      MP_EXCH(const mp_int *, a, b);
+   }
+
+   /* init temps */
+   if ((err = mp_init_multi(&S1, &S2, &T1, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* B */
+   B = MP_MAX((a->used + 2) / 3, (b->used + 1) / 2);
+
+   /** a = a2 * x^2 + a1 * x + a0; */
+   if ((err = mp_init_size(&a0, B)) != MP_OKAY)                   goto LBL_ERRa0;
+   if ((err = mp_init_size(&a1, B)) != MP_OKAY)                   goto LBL_ERRa1;
+   if ((err = mp_init_size(&a2, B)) != MP_OKAY)                   goto LBL_ERRa2;
+
+   a0.used = MP_MIN(a->used, B);
+   a1.used = MP_MIN(a->used - a0.used, B);
+   a2.used = a->used - a0.used - a1.used;
+   s_mp_copy_digs(a0.dp, a->dp, a0.used);
+   s_mp_copy_digs(a1.dp, a->dp + B, a1.used);
+   s_mp_copy_digs(a2.dp, a->dp + 2 * B, a2.used);
+   mp_clamp(&a0);
+   mp_clamp(&a1);
+   mp_clamp(&a2);
+
+   /** b = b1 * x + b0; */
+   if ((err = mp_init_size(&b0, B)) != MP_OKAY)                   goto LBL_ERRb0;
+   if ((err = mp_init_size(&b1, B)) != MP_OKAY)                   goto LBL_ERRb1;
+
+   b0.used = MP_MIN(b->used, B);
+   b1.used = b->used - b0.used;
+   s_mp_copy_digs(b0.dp, b->dp, b0.used);
+   s_mp_copy_digs(b1.dp, b->dp + B, b1.used);
+   mp_clamp(&b0);
+   mp_clamp(&b1);
+
+   /** \\ S1 = (a2+a1+a0) * (b1+b0), S2 = (a2-a1+a0) * (b0-b1); */
+   /** T1 = a2 + a0; */
+   if ((err = mp_add(&a2, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = T1 + a1; S2 = T1 - a1; */
+   if ((err = mp_add(&T1, &a1, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &a1, &S2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = b1 + b0; S1 = S1 * T1; */
+   if ((err = mp_add(&b1, &b0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S1, &T1, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = b0 - b1; S2 = S2 * T1; */
+   if ((err = mp_sub(&b0, &b1, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S2, &T1, &S2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** a0 = a0 * b0; a2 = a2 * b1; */
+   if ((err = mp_mul(&a0, &b0, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&a2, &b1, &a2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** \\ P = a2*x^3 + r2*x^2 + r1*x + a0; */
+   /** T1 = (S1 - S2)/2 - a2; \\ r1 */
+   if ((err = mp_sub(&S1, &S2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T1, &a2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = (S1 + S2)/2 - a0; \\ r2 */
+   if ((err = mp_add(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&S1, &S1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&S1, &a0, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** P = a2*x^3 + S1*x^2 + T1*x + a0; */
+   if ((err = mp_lshd(&a2, 3 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_lshd(&S1, 2 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a2, &S1, &a2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&T1, 1 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a2, &T1, &a2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&a2, &a0, c)) != MP_OKAY)                    goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear(&b1);
+LBL_ERRb1:
+   mp_clear(&b0);
+LBL_ERRb0:
+   mp_clear(&a2);
+LBL_ERRa2:
+   mp_clear(&a1);
+LBL_ERRa1:
+   mp_clear(&a0);
+LBL_ERRa0:
+   mp_clear_multi(&S1, &S2, &T1, NULL);
+   return err;
+}
+
+#endif
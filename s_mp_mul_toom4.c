@@ -0,0 +1,245 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM4_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* multiplication using the Toom-Cook 4-way algorithm
+ *
+ * Splits the inputs into four parts and evaluates them at the seven
+ * points 0, 1, -1, 2, -2, 1/2 and infinity, which replaces 16
+ * multiplications of a quarter of the size by 7.  This gives an
+ * asymptotic running time of O(N**1.404).  It sits between Toom-3
+ * and the NTT multiplication.
+ *
+ * All divisions in the interpolation are exact: by powers of two,
+ * by three and by fifteen.
+*/
+
+/*
+   Evaluation and interpolation sequence after
+
+     Bodrato, Marco, and Alberto Zanoni. "Integer and polynomial multiplication:
+     towards optimal Toom-Cook matrices."
+     Proceedings of the 2007 international symposium on Symbolic and algebraic
+     computation (ISSAC '07). ACM, 2007.
+*/
+
+mp_err s_mp_mul_toom4(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int S1, S2, S3, S4, S5, T1, T2, a0, a1, a2, a3, b0, b1, b2, b3;
+   int B;
+   mp_err err;
+
+   /* init temps */
+   if ((err = mp_init_multi(&S1, &S2, &S3, &S4, &S5, &T1, &T2, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* B */
+   B = MP_MIN(a->used, b->used) / 4;
+
+   /** a = a3 * x^3 + a2 * x^2 + a1 * x + a0; */
+   if ((err = mp_init_size(&a0, B)) != MP_OKAY)                   goto LBL_ERRa0;
+   if ((err = mp_init_size(&a1, B)) != MP_OKAY)                   goto LBL_ERRa1;
+   if ((err = mp_init_size(&a2, B)) != MP_OKAY)                   goto LBL_ERRa2;
+   if ((err = mp_init_size(&a3, a->used - 3 * B)) != MP_OKAY)     goto LBL_ERRa3;
+
+   a0.used = a1.used = a2.used = B;
+   a3.used = a->used - 3 * B;
+   s_mp_copy_digs(a0.dp, a->dp, a0.used);
+   s_mp_copy_digs(a1.dp, a->dp + B, a1.used);
+   s_mp_copy_digs(a2.dp, a->dp + 2 * B, a2.used);
+   s_mp_copy_digs(a3.dp, a->dp + 3 * B, a3.used);
+   mp_clamp(&a0);
+   mp_clamp(&a1);
+   mp_clamp(&a2);
+   mp_clamp(&a3);
+
+   /** b = b3 * x^3 + b2 * x^2 + b1 * x + b0; */
+   if ((err = mp_init_size(&b0, B)) != MP_OKAY)                   goto LBL_ERRb0;
+   if ((err = mp_init_size(&b1, B)) != MP_OKAY)                   goto LBL_ERRb1;
+   if ((err = mp_init_size(&b2, B)) != MP_OKAY)                   goto LBL_ERRb2;
+   if ((err = mp_init_size(&b3, b->used - 3 * B)) != MP_OKAY)     goto LBL_ERRb3;
+
+   b0.used = b1.used = b2.used = B;
+   b3.used = b->used - 3 * B;
+   s_mp_copy_digs(b0.dp, b->dp, b0.used);
+   s_mp_copy_digs(b1.dp, b->dp + B, b1.used);
+   s_mp_copy_digs(b2.dp, b->dp + 2 * B, b2.used);
+   s_mp_copy_digs(b3.dp, b->dp + 3 * B, b3.used);
+   mp_clamp(&b0);
+   mp_clamp(&b1);
+   mp_clamp(&b2);
+   mp_clamp(&b3);
+
+   /** \\ S1 = a(1) * b(1), S2 = a(-1) * b(-1); */
+   /** T1 = a2 + a0; T2 = a3 + a1; */
+   if ((err = mp_add(&a2, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&a3, &a1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = T1 + T2; S2 = T1 - T2; */
+   if ((err = mp_add(&T1, &T2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &S2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = b2 + b0; T2 = b3 + b1; */
+   if ((err = mp_add(&b2, &b0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&b3, &b1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S3 = T1 + T2; S1 = S1 * S3; */
+   if ((err = mp_add(&T1, &T2, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S1, &S3, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = T1 - T2; S2 = S2 * T1; */
+   if ((err = mp_sub(&T1, &T2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S2, &T1, &S2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** \\ S3 = a(2) * b(2), S4 = a(-2) * b(-2); */
+   /** T1 = (a2 << 2) + a0; T2 = ((a3 << 2) + a1) << 1; */
+   if ((err = mp_mul_2d(&a2, 2, &T1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T1, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&a3, 2, &T2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T2, &a1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S3 = T1 + T2; S4 = T1 - T2; */
+   if ((err = mp_add(&T1, &T2, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &S4)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = (b2 << 2) + b0; T2 = ((b3 << 2) + b1) << 1; */
+   if ((err = mp_mul_2d(&b2, 2, &T1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T1, &b0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&b3, 2, &T2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T2, &b1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S5 = T1 + T2; S3 = S3 * S5; */
+   if ((err = mp_add(&T1, &T2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S3, &S5, &S3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = T1 - T2; S4 = S4 * T1; */
+   if ((err = mp_sub(&T1, &T2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S4, &T1, &S4)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** \\ S5 = (8*a0+4*a1+2*a2+a3) * (8*b0+4*b1+2*b2+b3); */
+   /** T1 = (((a0 << 1) + a1) << 1 + a2) << 1 + a3; */
+   if ((err = mp_mul_2(&a0, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T1, &a1, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T1, &a2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T1, &a3, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T2 = (((b0 << 1) + b1) << 1 + b2) << 1 + b3; */
+   if ((err = mp_mul_2(&b0, &T2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T2, &b1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T2, &b2, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T2, &b3, &T2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S5 = T1 * T2; */
+   if ((err = mp_mul(&T1, &T2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** a0 = a0 * b0; b3 = a3 * b3; */
+   if ((err = mp_mul(&a0, &b0, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&a3, &b3, &b3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** \\ P = r6*x^6 + ... + r1*x + r0 with r0 = a0 and r6 = b3, interpolate r1..r5; */
+   /** T1 = (S1 + S2)/2 - a0 - b3; \\ r2 + r4 */
+   if ((err = mp_add(&S1, &S2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T1, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &b3, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = (S1 - S2)/2; \\ r1 + r3 + r5 */
+   if ((err = mp_sub(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&S1, &S1)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** T2 = ((S3 + S4)/2 - a0 - (b3 << 6))/4; \\ r2 + 4*r4 */
+   if ((err = mp_add(&S3, &S4, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T2, &a0, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&b3, 6, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&T2, &S2, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2d(&T2, 2, &T2, NULL)) != MP_OKAY)           goto LBL_ERR;
+
+   /** S3 = (S3 - S4)/4; \\ r1 + 4*r3 + 16*r5 */
+   if ((err = mp_sub(&S3, &S4, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2d(&S3, 2, &S3, NULL)) != MP_OKAY)           goto LBL_ERR;
+
+   /** T2 = (T2 - T1)/3; \\ r4 */
+   if ((err = mp_sub(&T2, &T1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&T2, &T2, NULL)) != MP_OKAY)             goto LBL_ERR;
+
+   /** T1 = T1 - T2; \\ r2 */
+   if ((err = mp_sub(&T1, &T2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S5 = (S5 - (a0 << 6) - b3 - (T1 << 4) - (T2 << 2))/2; \\ 16*r1 + 4*r3 + r5 */
+   if ((err = mp_mul_2d(&a0, 6, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S5, &S2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&S5, &b3, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&T1, 4, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S5, &S2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&T2, 2, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S5, &S2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&S5, &S5)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S3 = (S3 - S1)/3; \\ r3 + 5*r5 */
+   if ((err = mp_sub(&S3, &S1, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&S3, &S3, NULL)) != MP_OKAY)             goto LBL_ERR;
+
+   /** S5 = (S5 - S1)/3; \\ 5*r1 + r3 */
+   if ((err = mp_sub(&S5, &S1, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&S5, &S5, NULL)) != MP_OKAY)             goto LBL_ERR;
+
+   /** S2 = ((S3 << 2) + S5 - 5*S1)/15; \\ r5 */
+   if ((err = mp_mul_2d(&S3, 2, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&S2, &S5, &S2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_d(&S1, 5u, &S4)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S2, &S4, &S2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_d(&S2, 15u, &S2, NULL)) != MP_OKAY)          goto LBL_ERR;
+
+   /** S3 = S3 - 5*S2; \\ r3 */
+   if ((err = mp_mul_d(&S2, 5u, &S4)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S3, &S4, &S3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = S1 - S3 - S2; \\ r1 */
+   if ((err = mp_sub(&S1, &S3, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** P = b3*x^6 + S2*x^5 + T2*x^4 + S3*x^3 + T1*x^2 + S1*x + a0; */
+   if ((err = mp_lshd(&b3, 6 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_lshd(&S2, 5 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&b3, &S2, &b3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&T2, 4 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&b3, &T2, &b3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&S3, 3 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&b3, &S3, &b3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&T1, 2 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&b3, &T1, &b3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&S1, 1 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&b3, &S1, &b3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&b3, &a0, c)) != MP_OKAY)                    goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear(&b3);
+LBL_ERRb3:
+   mp_clear(&b2);
+LBL_ERRb2:
+   mp_clear(&b1);
+LBL_ERRb1:
+   mp_clear(&b0);
+LBL_ERRb0:
+   mp_clear(&a3);
+LBL_ERRa3:
+   mp_clear(&a2);
+LBL_ERRa2:
+   mp_clear(&a1);
+LBL_ERRa1:
+   mp_clear(&a0);
+LBL_ERRa0:
+   mp_clear_multi(&S1, &S2, &S3, &S4, &S5, &T1, &T2, NULL);
+   return err;
+}
+
+#endif
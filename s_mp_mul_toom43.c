@@ -0,0 +1,177 @@
+#include "tommath_private.h"
+#ifdef S_MP_MUL_TOOM43_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* unbalanced multiplication using the Toom-Cook 4/3 algorithm
+ *
+ * The larger input is split into four parts and the smaller one into
+ * three parts of the same size, the product is a polynomial of degree
+ * five evaluated at 0, 1, -1, 2, -2 and infinity.  That are six
+ * multiplications for inputs with a size ratio of about 4:3.
+*/
+mp_err s_mp_mul_toom43(const mp_int *a, const mp_int *b, mp_int *c)
+{
+   mp_int S1, S2, S3, S4, T1, T2, a0, a1, a2, a3, b0, b1, b2;
+   int B;
+   mp_err err;
+
+   /* Make sure that a is the larger one */
+   if (a->used < b->used) {
+      MP_EXCH(const mp_int *, a, b);
+   }
+
+   /* init temps */
+   if ((err = mp_init_multi(&S1, &S2, &S3, &S4, &T1, &T2, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* B */
+   B = MP_MAX((a->used + 3) / 4, (b->used + 2) / 3);
+
+   /** a = a3 * x^3 + a2 * x^2 + a1 * x + a0; */
+   if ((err = mp_init_size(&a0, B)) != MP_OKAY)                   goto LBL_ERRa0;
+   if ((err = mp_init_size(&a1, B)) != MP_OKAY)                   goto LBL_ERRa1;
+   if ((err = mp_init_size(&a2, B)) != MP_OKAY)                   goto LBL_ERRa2;
+   if ((err = mp_init_size(&a3, B)) != MP_OKAY)                   goto LBL_ERRa3;
+
+   a0.used = MP_MIN(a->used, B);
+   a1.used = MP_MIN(a->used - a0.used, B);
+   a2.used = MP_MIN(a->used - a0.used - a1.used, B);
+   a3.used = a->used - a0.used - a1.used - a2.used;
+   s_mp_copy_digs(a0.dp, a->dp, a0.used);
+   s_mp_copy_digs(a1.dp, a->dp + B, a1.used);
+   s_mp_copy_digs(a2.dp, a->dp + 2 * B, a2.used);
+   s_mp_copy_digs(a3.dp, a->dp + 3 * B, a3.used);
+   mp_clamp(&a0);
+   mp_clamp(&a1);
+   mp_clamp(&a2);
+   mp_clamp(&a3);
+
+   /** b = b2 * x^2 + b1 * x + b0; */
+   if ((err = mp_init_size(&b0, B)) != MP_OKAY)                   goto LBL_ERRb0;
+   if ((err = mp_init_size(&b1, B)) != MP_OKAY)                   goto LBL_ERRb1;
+   if ((err = mp_init_size(&b2, B)) != MP_OKAY)                   goto LBL_ERRb2;
+
+   b0.used = MP_MIN(b->used, B);
+   b1.used = MP_MIN(b->used - b0.used, B);
+   b2.used = b->used - b0.used - b1.used;
+   s_mp_copy_digs(b0.dp, b->dp, b0.used);
+   s_mp_copy_digs(b1.dp, b->dp + B, b1.used);
+   s_mp_copy_digs(b2.dp, b->dp + 2 * B, b2.used);
+   mp_clamp(&b0);
+   mp_clamp(&b1);
+   mp_clamp(&b2);
+
+   /** \\ S1 = a(1) * b(1), S2 = a(-1) * b(-1); */
+   /** T1 = a2 + a0; T2 = a3 + a1; */
+   if ((err = mp_add(&a2, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&a3, &a1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = T1 + T2; S2 = T1 - T2; */
+   if ((err = mp_add(&T1, &T2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &S2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = b2 + b0; */
+   if ((err = mp_add(&b2, &b0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T2 = T1 + b1; S1 = S1 * T2; */
+   if ((err = mp_add(&T1, &b1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S1, &T2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = T1 - b1; S2 = S2 * T1; */
+   if ((err = mp_sub(&T1, &b1, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S2, &T1, &S2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** \\ S3 = a(2) * b(2), S4 = a(-2) * b(-2); */
+   /** T1 = (a2 << 2) + a0; T2 = ((a3 << 2) + a1) << 1; */
+   if ((err = mp_mul_2d(&a2, 2, &T1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T1, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&a3, 2, &T2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T2, &a1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S3 = T1 + T2; S4 = T1 - T2; */
+   if ((err = mp_add(&T1, &T2, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &S4)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T1 = (b2 << 2) + b0; T2 = b1 << 1; */
+   if ((err = mp_mul_2d(&b2, 2, &T1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T1, &b0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&b1, &T2)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S4 = S4 * (T1 - T2); S3 = S3 * (T1 + T2); */
+   if ((err = mp_sub(&T1, &T2, &b1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S4, &b1, &S4)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&T1, &T2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&S3, &T1, &S3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** a0 = a0 * b0; a3 = a3 * b2; */
+   if ((err = mp_mul(&a0, &b0, &a0)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul(&a3, &b2, &a3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** \\ P = r5*x^5 + ... + r1*x + r0 with r0 = a0 and r5 = a3, interpolate r1..r4; */
+   /** T1 = (S1 + S2)/2 - a0; \\ r2 + r4 */
+   if ((err = mp_add(&S1, &S2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T1, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = (S1 - S2)/2 - a3; \\ r1 + r3 */
+   if ((err = mp_sub(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&S1, &S1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&S1, &a3, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T2 = ((S3 + S4)/2 - a0)/4; \\ r2 + 4*r4 */
+   if ((err = mp_add(&S3, &S4, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T2, &a0, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2d(&T2, 2, &T2, NULL)) != MP_OKAY)           goto LBL_ERR;
+
+   /** S3 = (S3 - S4)/4 - (a3 << 4); \\ r1 + 4*r3 */
+   if ((err = mp_sub(&S3, &S4, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2d(&S3, 2, &S3, NULL)) != MP_OKAY)           goto LBL_ERR;
+   if ((err = mp_mul_2d(&a3, 4, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S3, &S2, &S3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** T2 = (T2 - T1)/3; T1 = T1 - T2; \\ r4, r2 */
+   if ((err = mp_sub(&T2, &T1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&T2, &T2, NULL)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S3 = (S3 - S1)/3; S1 = S1 - S3; \\ r3, r1 */
+   if ((err = mp_sub(&S3, &S1, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&S3, &S3, NULL)) != MP_OKAY)             goto LBL_ERR;
+   if ((err = mp_sub(&S1, &S3, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** P = a3*x^5 + T2*x^4 + S3*x^3 + T1*x^2 + S1*x + a0; */
+   if ((err = mp_lshd(&a3, 5 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_lshd(&T2, 4 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &T2, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&S3, 3 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &S3, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&T1, 2 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &T1, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&S1, 1 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &S1, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&a3, &a0, c)) != MP_OKAY)                    goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear(&b2);
+LBL_ERRb2:
+   mp_clear(&b1);
+LBL_ERRb1:
+   mp_clear(&b0);
+LBL_ERRb0:
+   mp_clear(&a3);
+LBL_ERRa3:
+   mp_clear(&a2);
+LBL_ERRa2:
+   mp_clear(&a1);
+LBL_ERRa1:
+   mp_clear(&a0);
+LBL_ERRa0:
+   mp_clear_multi(&S1, &S2, &S3, &S4, &T1, &T2, NULL);
+   return err;
+}
+
+#endif
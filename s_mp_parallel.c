@@ -0,0 +1,209 @@
+#include "tommath_private.h"
+#ifdef S_MP_PARALLEL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* calls fn for each of the n elements of size bytes at args on up to threads threads
+ *
+ * The calling thread is one of them.  Every thread starts with its own
+ * contiguous range of the elements and works through it from the front,
+ * when it is done it steals the back half of the largest range left.
+ * Threads which cannot be started leave their range to the others, so this
+ * cannot fail.  Without thread support, i.e. on platforms other than POSIX
+ * and Windows or if MP_NO_THREADS is defined, the elements are done one
+ * after the other.
+ */
+
+#if !defined(MP_NO_THREADS) && defined(_WIN32)
+#define S_THREADS_WIN32
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+typedef HANDLE s_thread_handle;
+typedef CRITICAL_SECTION s_mutex;
+#elif !defined(MP_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define S_THREADS_POSIX
+
+#include <pthread.h>
+
+typedef pthread_t s_thread_handle;
+typedef pthread_mutex_t s_mutex;
+#endif
+
+static void s_run_all(mp_task_fn fn, void *args, size_t size, int n)
+{
+   int i;
+   for (i = 0; i < n; i++) {
+      fn((char *)args + ((size_t)i * size));
+   }
+}
+
+#if defined(S_THREADS_WIN32) || defined(S_THREADS_POSIX)
+typedef struct s_pool s_pool;
+
+typedef struct {
+   s_pool *pool;
+   int next, end;       /* the elements left to this thread */
+   s_thread_handle handle;
+   bool started;
+} s_worker;
+
+struct s_pool {
+   mp_task_fn fn;
+   char *args;
+   size_t size;
+   int threads;
+   s_worker *w;
+   s_mutex lock;
+};
+
+#ifdef S_THREADS_WIN32
+static bool s_mutex_init(s_mutex *m)
+{
+   InitializeCriticalSection(m);
+   return true;
+}
+#define s_mutex_lock(m)    EnterCriticalSection(m)
+#define s_mutex_unlock(m)  LeaveCriticalSection(m)
+#define s_mutex_free(m)    DeleteCriticalSection(m)
+#else
+static bool s_mutex_init(s_mutex *m)
+{
+   return pthread_mutex_init(m, NULL) == 0;
+}
+#define s_mutex_lock(m)    (void)pthread_mutex_lock(m)
+#define s_mutex_unlock(m)  (void)pthread_mutex_unlock(m)
+#define s_mutex_free(m)    (void)pthread_mutex_destroy(m)
+#endif
+
+/* the next element for w, false if there is none left */
+static bool s_take(s_worker *w, int *i)
+{
+   s_pool *p = w->pool;
+   s_worker *v;
+   int k, left;
+
+   s_mutex_lock(&p->lock);
+   if (w->next == w->end) {
+      v = NULL;
+      left = 0;
+      for (k = 0; k < p->threads; k++) {
+         if ((p->w[k].end - p->w[k].next) > left) {
+            v = &p->w[k];
+            left = v->end - v->next;
+         }
+      }
+      if (v == NULL) {
+         s_mutex_unlock(&p->lock);
+         return false;
+      }
+      w->end = v->end;
+      v->end -= (left + 1) / 2;
+      w->next = v->end;
+   }
+   *i = w->next++;
+   s_mutex_unlock(&p->lock);
+   return true;
+}
+
+static void s_work(s_worker *w)
+{
+   int i;
+   while (s_take(w, &i)) {
+      w->pool->fn(w->pool->args + ((size_t)i * w->pool->size));
+   }
+}
+
+#ifdef S_THREADS_WIN32
+static DWORD WINAPI s_thread_main(LPVOID p)
+{
+   s_work((s_worker *)p);
+   return 0;
+}
+
+static bool s_thread_start(s_worker *w)
+{
+   w->handle = CreateThread(NULL, 0, s_thread_main, w, 0, NULL);
+   return w->handle != NULL;
+}
+
+static void s_thread_join(s_worker *w)
+{
+   WaitForSingleObject(w->handle, INFINITE);
+   CloseHandle(w->handle);
+}
+#else
+static void *s_thread_main(void *p)
+{
+   s_work((s_worker *)p);
+   return NULL;
+}
+
+static bool s_thread_start(s_worker *w)
+{
+   return pthread_create(&w->handle, NULL, s_thread_main, w) == 0;
+}
+
+static void s_thread_join(s_worker *w)
+{
+   (void)pthread_join(w->handle, NULL);
+}
+#endif
+
+void s_mp_parallel(mp_task_fn fn, void *args, size_t size, int n, int threads)
+{
+   const mp_kernel_table *kernels;
+   s_pool p;
+   int i;
+
+   threads = MP_MIN(threads, n);
+   if (threads < 2) {
+      s_run_all(fn, args, size, n);
+      return;
+   }
+   /* choose the kernels before there is a second thread to race with */
+   kernels = s_mp_kernels();
+   (void)kernels;
+   p.w = (s_worker *) MP_CALLOC((size_t)threads, sizeof(*p.w));
+   if (p.w == NULL) {
+      s_run_all(fn, args, size, n);
+      return;
+   }
+   if (!s_mutex_init(&p.lock)) {
+      MP_FREE(p.w, (size_t)threads * sizeof(*p.w));
+      s_run_all(fn, args, size, n);
+      return;
+   }
+   p.fn = fn;
+   p.args = (char *)args;
+   p.size = size;
+   p.threads = threads;
+
+   for (i = 0; i < threads; i++) {
+      p.w[i].pool = &p;
+      p.w[i].next = (int)(((int64_t)n * i) / threads);
+      p.w[i].end = (int)(((int64_t)n * (i + 1)) / threads);
+   }
+   for (i = 1; i < threads; i++) {
+      p.w[i].started = s_thread_start(&p.w[i]);
+   }
+   s_work(&p.w[0]);
+   for (i = 1; i < threads; i++) {
+      if (p.w[i].started) {
+         s_thread_join(&p.w[i]);
+      }
+   }
+
+   s_mutex_free(&p.lock);
+   MP_FREE(p.w, (size_t)threads * sizeof(*p.w));
+}
+#else
+void s_mp_parallel(mp_task_fn fn, void *args, size_t size, int n, int threads)
+{
+   (void)threads;
+   s_run_all(fn, args, size, n);
+}
+#endif
+
+#endif
@@ -10,12 +10,35 @@
  */
 mp_err s_mp_prime_is_divisible(const mp_int *a, bool *result)
 {
-   int i;
+   mp_digit res_tab[MP_PRIME_TAB_SIZE];
+   int i, j, n;
+
+   /* longer a take the primes in chunks of 8, 16, 32, ... through
+    * mp_mod_d_multi, most of them have a factor in the first ones
+    */
+   if (MP_HAS(MP_MOD_D_MULTI) && (a->used >= MP_PRIME_TAB_MULTI_DIGITS)) {
+      for (i = 0, n = 8; i < MP_PRIME_TAB_SIZE; i += n, n *= 2) {
+         mp_err err;
+         n = MP_MIN(n, MP_PRIME_TAB_SIZE - i);
+         if ((err = mp_mod_d_multi(a, s_mp_prime_tab + i, n, res_tab + i)) != MP_OKAY) {
+            return err;
+         }
+         for (j = i; j < (i + n); j++) {
+            if (res_tab[j] == 0u) {
+               *result = true;
+               return MP_OKAY;
+            }
+         }
+      }
+      *result = false;
+      return MP_OKAY;
+   }
+
    for (i = 0; i < MP_PRIME_TAB_SIZE; i++) {
-      /* what is a mod LBL_prime_tab[i] */
+      /* what is a mod s_mp_prime_tab[i], with its reciprocal */
       mp_err err;
       mp_digit res;
-      if ((err = mp_mod_d(a, s_mp_prime_tab[i], &res)) != MP_OKAY) {
+      if ((err = s_mp_div_d_recip(a, &s_mp_prime_recip_tab[i], NULL, &res)) != MP_OKAY) {
          return err;
       }
 
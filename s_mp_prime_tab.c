@@ -3,42 +3,63 @@
 /* LibTomMath, multiple-precision integer library -- Tom St Denis */
 /* SPDX-License-Identifier: Unlicense */
 
-const mp_digit s_mp_prime_tab[] = {
-   0x0002, 0x0003, 0x0005, 0x0007, 0x000B, 0x000D, 0x0011, 0x0013,
-   0x0017, 0x001D, 0x001F, 0x0025, 0x0029, 0x002B, 0x002F, 0x0035,
-   0x003B, 0x003D, 0x0043, 0x0047, 0x0049, 0x004F, 0x0053, 0x0059,
-   0x0061, 0x0065, 0x0067, 0x006B, 0x006D, 0x0071, 0x007F, 0x0083,
-   0x0089, 0x008B, 0x0095, 0x0097, 0x009D, 0x00A3, 0x00A7, 0x00AD,
-   0x00B3, 0x00B5, 0x00BF, 0x00C1, 0x00C5, 0x00C7, 0x00D3, 0x00DF,
-   0x00E3, 0x00E5, 0x00E9, 0x00EF, 0x00F1, 0x00FB, 0x0101, 0x0107,
-   0x010D, 0x010F, 0x0115, 0x0119, 0x011B, 0x0125, 0x0133, 0x0137,
+/* the first MP_PRIME_TAB_SIZE primes */
+#define S_PRIMES(X) \
+   X(0x0002) X(0x0003) X(0x0005) X(0x0007) X(0x000B) X(0x000D) X(0x0011) X(0x0013) \
+   X(0x0017) X(0x001D) X(0x001F) X(0x0025) X(0x0029) X(0x002B) X(0x002F) X(0x0035) \
+   X(0x003B) X(0x003D) X(0x0043) X(0x0047) X(0x0049) X(0x004F) X(0x0053) X(0x0059) \
+   X(0x0061) X(0x0065) X(0x0067) X(0x006B) X(0x006D) X(0x0071) X(0x007F) X(0x0083) \
+   X(0x0089) X(0x008B) X(0x0095) X(0x0097) X(0x009D) X(0x00A3) X(0x00A7) X(0x00AD) \
+   X(0x00B3) X(0x00B5) X(0x00BF) X(0x00C1) X(0x00C5) X(0x00C7) X(0x00D3) X(0x00DF) \
+   X(0x00E3) X(0x00E5) X(0x00E9) X(0x00EF) X(0x00F1) X(0x00FB) X(0x0101) X(0x0107) \
+   X(0x010D) X(0x010F) X(0x0115) X(0x0119) X(0x011B) X(0x0125) X(0x0133) X(0x0137) \
+   X(0x0139) X(0x013D) X(0x014B) X(0x0151) X(0x015B) X(0x015D) X(0x0161) X(0x0167) \
+   X(0x016F) X(0x0175) X(0x017B) X(0x017F) X(0x0185) X(0x018D) X(0x0191) X(0x0199) \
+   X(0x01A3) X(0x01A5) X(0x01AF) X(0x01B1) X(0x01B7) X(0x01BB) X(0x01C1) X(0x01C9) \
+   X(0x01CD) X(0x01CF) X(0x01D3) X(0x01DF) X(0x01E7) X(0x01EB) X(0x01F3) X(0x01F7) \
+   X(0x01FD) X(0x0209) X(0x020B) X(0x021D) X(0x0223) X(0x022D) X(0x0233) X(0x0239) \
+   X(0x023B) X(0x0241) X(0x024B) X(0x0251) X(0x0257) X(0x0259) X(0x025F) X(0x0265) \
+   X(0x0269) X(0x026B) X(0x0277) X(0x0281) X(0x0283) X(0x0287) X(0x028D) X(0x0293) \
+   X(0x0295) X(0x02A1) X(0x02A5) X(0x02AB) X(0x02B3) X(0x02BD) X(0x02C5) X(0x02CF) \
+   X(0x02D7) X(0x02DD) X(0x02E3) X(0x02E7) X(0x02EF) X(0x02F5) X(0x02F9) X(0x0301) \
+   X(0x0305) X(0x0313) X(0x031D) X(0x0329) X(0x032B) X(0x0335) X(0x0337) X(0x033B) \
+   X(0x033D) X(0x0347) X(0x0355) X(0x0359) X(0x035B) X(0x035F) X(0x036D) X(0x0371) \
+   X(0x0373) X(0x0377) X(0x038B) X(0x038F) X(0x0397) X(0x03A1) X(0x03A9) X(0x03AD) \
+   X(0x03B3) X(0x03B9) X(0x03C7) X(0x03CB) X(0x03D1) X(0x03D7) X(0x03DF) X(0x03E5) \
+   X(0x03F1) X(0x03F5) X(0x03FB) X(0x03FD) X(0x0407) X(0x0409) X(0x040F) X(0x0419) \
+   X(0x041B) X(0x0425) X(0x0427) X(0x042D) X(0x043F) X(0x0443) X(0x0445) X(0x0449) \
+   X(0x044F) X(0x0455) X(0x045D) X(0x0463) X(0x0469) X(0x047F) X(0x0481) X(0x048B) \
+   X(0x0493) X(0x049D) X(0x04A3) X(0x04A9) X(0x04B1) X(0x04BD) X(0x04C1) X(0x04C7) \
+   X(0x04CD) X(0x04CF) X(0x04D5) X(0x04E1) X(0x04EB) X(0x04FD) X(0x04FF) X(0x0503) \
+   X(0x0509) X(0x050B) X(0x0511) X(0x0515) X(0x0517) X(0x051B) X(0x0527) X(0x0529) \
+   X(0x052F) X(0x0551) X(0x0557) X(0x055D) X(0x0565) X(0x0577) X(0x0581) X(0x058F) \
+   X(0x0593) X(0x0595) X(0x0599) X(0x059F) X(0x05A7) X(0x05AB) X(0x05AD) X(0x05B3) \
+   X(0x05BF) X(0x05C9) X(0x05CB) X(0x05CF) X(0x05D1) X(0x05D5) X(0x05DB) X(0x05E7) \
+   X(0x05F3) X(0x05FB) X(0x0607) X(0x060D) X(0x0611) X(0x0617) X(0x061F) X(0x0623) \
+   X(0x062B) X(0x062F) X(0x063D) X(0x0641) X(0x0647) X(0x0649) X(0x064D) X(0x0653)
 
-   0x0139, 0x013D, 0x014B, 0x0151, 0x015B, 0x015D, 0x0161, 0x0167,
-   0x016F, 0x0175, 0x017B, 0x017F, 0x0185, 0x018D, 0x0191, 0x0199,
-   0x01A3, 0x01A5, 0x01AF, 0x01B1, 0x01B7, 0x01BB, 0x01C1, 0x01C9,
-   0x01CD, 0x01CF, 0x01D3, 0x01DF, 0x01E7, 0x01EB, 0x01F3, 0x01F7,
-   0x01FD, 0x0209, 0x020B, 0x021D, 0x0223, 0x022D, 0x0233, 0x0239,
-   0x023B, 0x0241, 0x024B, 0x0251, 0x0257, 0x0259, 0x025F, 0x0265,
-   0x0269, 0x026B, 0x0277, 0x0281, 0x0283, 0x0287, 0x028D, 0x0293,
-   0x0295, 0x02A1, 0x02A5, 0x02AB, 0x02B3, 0x02BD, 0x02C5, 0x02CF,
+#define S_PRIME(p) p,
+const mp_digit s_mp_prime_tab[] = {
+   S_PRIMES(S_PRIME)
+};
 
-   0x02D7, 0x02DD, 0x02E3, 0x02E7, 0x02EF, 0x02F5, 0x02F9, 0x0301,
-   0x0305, 0x0313, 0x031D, 0x0329, 0x032B, 0x0335, 0x0337, 0x033B,
-   0x033D, 0x0347, 0x0355, 0x0359, 0x035B, 0x035F, 0x036D, 0x0371,
-   0x0373, 0x0377, 0x038B, 0x038F, 0x0397, 0x03A1, 0x03A9, 0x03AD,
-   0x03B3, 0x03B9, 0x03C7, 0x03CB, 0x03D1, 0x03D7, 0x03DF, 0x03E5,
-   0x03F1, 0x03F5, 0x03FB, 0x03FD, 0x0407, 0x0409, 0x040F, 0x0419,
-   0x041B, 0x0425, 0x0427, 0x042D, 0x043F, 0x0443, 0x0445, 0x0449,
-   0x044F, 0x0455, 0x045D, 0x0463, 0x0469, 0x047F, 0x0481, 0x048B,
+/* the shift which moves p < 2**11 to the top bit of a digit */
+#define S_SHIFT(p) (MP_DIGIT_BIT - (((p) < 0x4u) ? 2 : ((p) < 0x8u) ? 3 : ((p) < 0x10u) ? 4 :        \
+                                    ((p) < 0x20u) ? 5 : ((p) < 0x40u) ? 6 : ((p) < 0x80u) ? 7 :       \
+                                    ((p) < 0x100u) ? 8 : ((p) < 0x200u) ? 9 : ((p) < 0x400u) ? 10 : 11))
 
-   0x0493, 0x049D, 0x04A3, 0x04A9, 0x04B1, 0x04BD, 0x04C1, 0x04C7,
-   0x04CD, 0x04CF, 0x04D5, 0x04E1, 0x04EB, 0x04FD, 0x04FF, 0x0503,
-   0x0509, 0x050B, 0x0511, 0x0515, 0x0517, 0x051B, 0x0527, 0x0529,
-   0x052F, 0x0551, 0x0557, 0x055D, 0x0565, 0x0577, 0x0581, 0x058F,
-   0x0593, 0x0595, 0x0599, 0x059F, 0x05A7, 0x05AB, 0x05AD, 0x05B3,
-   0x05BF, 0x05C9, 0x05CB, 0x05CF, 0x05D1, 0x05D5, 0x05DB, 0x05E7,
-   0x05F3, 0x05FB, 0x0607, 0x060D, 0x0611, 0x0617, 0x061F, 0x0623,
-   0x062B, 0x062F, 0x063D, 0x0641, 0x0647, 0x0649, 0x064D, 0x0653
+/* their reciprocals as s_mp_digit_recip computes them */
+#define S_B1(p) (((mp_word)1 << MP_DIGIT_BIT) % (mp_word)(p))
+#define S_B2(p) ((S_B1(p) * S_B1(p)) % (mp_word)(p))
+#define S_RECIP(p) {                                                                                \
+   (mp_digit)((mp_digit)(p) << S_SHIFT(p)),                                                        \
+   (mp_digit)(((((mp_word)1 << (2 * MP_DIGIT_BIT)) - 1u) / ((mp_word)(p) << S_SHIFT(p))) -          \
+              ((mp_word)1 << MP_DIGIT_BIT)),                                                       \
+   S_SHIFT(p),                                                                                     \
+   (mp_digit)S_B1(p), (mp_digit)S_B2(p), (mp_digit)((S_B1(p) * S_B2(p)) % (mp_word)(p))            \
+},
+const mp_digit_recip s_mp_prime_recip_tab[] = {
+   S_PRIMES(S_RECIP)
 };
 
 #endif
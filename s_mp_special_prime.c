@@ -0,0 +1,78 @@
+#include "tommath_private.h"
+#ifdef S_MP_SPECIAL_PRIME_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* the primes mp_reduce_special knows, NULL past the last one
+ *
+ * The terms are pairs of a factor and the index of an input word for every
+ * word of the result, each word ends with a zero, see FIPS 186-4 D.2.
+ */
+
+static const signed char s_p256_terms[] = {
+   1, 0,  1, 8,  1, 9, -1, 11, -1, 12, -1, 13, -1, 14, 0,
+   1, 1,  1, 9,  1, 10, -1, 12, -1, 13, -1, 14, -1, 15, 0,
+   1, 2,  1, 10,  1, 11, -1, 13, -1, 14, -1, 15, 0,
+   1, 3,  2, 11,  2, 12,  1, 13, -1, 15, -1, 8, -1, 9, 0,
+   1, 4,  2, 12,  2, 13,  1, 14, -1, 9, -1, 10, 0,
+   1, 5,  2, 13,  2, 14,  1, 15, -1, 10, -1, 11, 0,
+   1, 6,  3, 14,  2, 15,  1, 13, -1, 8, -1, 9, 0,
+   1, 7,  3, 15,  1, 8, -1, 10, -1, 11, -1, 12, -1, 13, 0
+};
+
+static const signed char s_p384_terms[] = {
+   1, 0,  1, 12,  1, 21,  1, 20, -1, 23, 0,
+   1, 1,  1, 13,  1, 22,  1, 23, -1, 12, -1, 20, 0,
+   1, 2,  1, 14,  1, 23, -1, 13, -1, 21, 0,
+   1, 3,  1, 15,  1, 12,  1, 20,  1, 21, -1, 14, -1, 22, -1, 23, 0,
+   1, 4,  2, 21,  1, 16,  1, 13,  1, 12,  1, 20,  1, 22, -1, 15, -2, 23, 0,
+   1, 5,  2, 22,  1, 17,  1, 14,  1, 13,  1, 21,  1, 23, -1, 16, 0,
+   1, 6,  2, 23,  1, 18,  1, 15,  1, 14,  1, 22, -1, 17, 0,
+   1, 7,  1, 19,  1, 16,  1, 15,  1, 23, -1, 18, 0,
+   1, 8,  1, 20,  1, 17,  1, 16, -1, 19, 0,
+   1, 9,  1, 21,  1, 18,  1, 17, -1, 20, 0,
+   1, 10,  1, 22,  1, 19,  1, 18, -1, 21, 0,
+   1, 11,  1, 23,  1, 20,  1, 19, -1, 22, 0
+};
+
+static const mp_special_prime s_primes[] = {
+   /* P-256 = 2**256 - 2**224 + 2**192 + 2**96 - 1 */
+   {
+      256, {
+         0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000001u, 0xFFFFFFFFu
+      }, s_p256_terms, 0u, 0u
+   },
+   /* P-384 = 2**384 - 2**128 - 2**96 + 2**32 - 1 */
+   {
+      384, {
+         0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+         0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu
+      }, s_p384_terms, 0u, 0u
+   },
+   /* P-521 = 2**521 - 1 */
+   {
+      521, {
+         0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+         0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+         0x000001FFu
+      }, NULL, 1u, 0u
+   },
+   /* Curve25519, 2**255 - 19 */
+   {
+      255, {
+         0xFFFFFFEDu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu
+      }, NULL, 19u, 0u
+   },
+   /* secp256k1, 2**256 - 2**32 - 977 */
+   {
+      256, {
+         0xFFFFFC2Fu, 0xFFFFFFFEu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu
+      }, NULL, 977u, 1u
+   }
+};
+
+const mp_special_prime *s_mp_special_prime(mp_digit i)
+{
+   return (i < (sizeof(s_primes) / sizeof(s_primes[0]))) ? &s_primes[i] : NULL;
+}
+#endif
@@ -0,0 +1,172 @@
+#include "tommath_private.h"
+#ifdef S_MP_SQR_TOOM4_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+
+/* squaring using the Toom-Cook 4-way algorithm
+ *
+ * Same evaluation points and interpolation as s_mp_mul_toom4 but
+ * with one evaluation per point and seven squarings.
+*/
+
+mp_err s_mp_sqr_toom4(const mp_int *a, mp_int *b)
+{
+   mp_int S1, S2, S3, S4, S5, T1, T2, a0, a1, a2, a3;
+   int B;
+   mp_err err;
+
+   /* init temps */
+   if ((err = mp_init_multi(&S1, &S2, &S3, &S4, &S5, &T1, &T2, NULL)) != MP_OKAY) {
+      return err;
+   }
+
+   /* B */
+   B = a->used / 4;
+
+   /** a = a3 * x^3 + a2 * x^2 + a1 * x + a0; */
+   if ((err = mp_init_size(&a0, B)) != MP_OKAY)                   goto LBL_ERRa0;
+   if ((err = mp_init_size(&a1, B)) != MP_OKAY)                   goto LBL_ERRa1;
+   if ((err = mp_init_size(&a2, B)) != MP_OKAY)                   goto LBL_ERRa2;
+   if ((err = mp_init_size(&a3, a->used - 3 * B)) != MP_OKAY)     goto LBL_ERRa3;
+
+   a0.used = a1.used = a2.used = B;
+   a3.used = a->used - 3 * B;
+   s_mp_copy_digs(a0.dp, a->dp, a0.used);
+   s_mp_copy_digs(a1.dp, a->dp + B, a1.used);
+   s_mp_copy_digs(a2.dp, a->dp + 2 * B, a2.used);
+   s_mp_copy_digs(a3.dp, a->dp + 3 * B, a3.used);
+   mp_clamp(&a0);
+   mp_clamp(&a1);
+   mp_clamp(&a2);
+   mp_clamp(&a3);
+
+   /** \\ S1 = a(1)^2, S2 = a(-1)^2; */
+   /** T1 = a2 + a0; T2 = a3 + a1; */
+   if ((err = mp_add(&a2, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&a3, &a1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = (T1 + T2)^2; S2 = (T1 - T2)^2; */
+   if ((err = mp_add(&T1, &T2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sqr(&S1, &S1)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &S2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sqr(&S2, &S2)) != MP_OKAY)                       goto LBL_ERR;
+
+   /** \\ S3 = a(2)^2, S4 = a(-2)^2; */
+   /** T1 = (a2 << 2) + a0; T2 = ((a3 << 2) + a1) << 1; */
+   if ((err = mp_mul_2d(&a2, 2, &T1)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T1, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&a3, 2, &T2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&T2, &a1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S3 = (T1 + T2)^2; S4 = (T1 - T2)^2; */
+   if ((err = mp_add(&T1, &T2, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sqr(&S3, &S3)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_sub(&T1, &T2, &S4)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sqr(&S4, &S4)) != MP_OKAY)                       goto LBL_ERR;
+
+   /** \\ S5 = (8*a0+4*a1+2*a2+a3)^2; */
+   /** T1 = (((a0 << 1) + a1) << 1 + a2) << 1 + a3; */
+   if ((err = mp_mul_2(&a0, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T1, &a1, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T1, &a2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_add(&T1, &a3, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sqr(&T1, &S5)) != MP_OKAY)                       goto LBL_ERR;
+
+   /** a0 = a0^2; a3 = a3^2; */
+   if ((err = mp_sqr(&a0, &a0)) != MP_OKAY)                       goto LBL_ERR;
+   if ((err = mp_sqr(&a3, &a3)) != MP_OKAY)                       goto LBL_ERR;
+
+   /** \\ P = r6*x^6 + ... + r1*x + r0 with r0 = a0 and r6 = a3, interpolate r1..r5; */
+   /** T1 = (S1 + S2)/2 - a0 - a3; \\ r2 + r4 */
+   if ((err = mp_add(&S1, &S2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T1, &T1)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T1, &a0, &T1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&T1, &a3, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = (S1 - S2)/2; \\ r1 + r3 + r5 */
+   if ((err = mp_sub(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&S1, &S1)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** T2 = ((S3 + S4)/2 - a0 - (a3 << 6))/4; \\ r2 + 4*r4 */
+   if ((err = mp_add(&S3, &S4, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&T2, &T2)) != MP_OKAY)                     goto LBL_ERR;
+   if ((err = mp_sub(&T2, &a0, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&a3, 6, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&T2, &S2, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2d(&T2, 2, &T2, NULL)) != MP_OKAY)           goto LBL_ERR;
+
+   /** S3 = (S3 - S4)/4; \\ r1 + 4*r3 + 16*r5 */
+   if ((err = mp_sub(&S3, &S4, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2d(&S3, 2, &S3, NULL)) != MP_OKAY)           goto LBL_ERR;
+
+   /** T2 = (T2 - T1)/3; \\ r4 */
+   if ((err = mp_sub(&T2, &T1, &T2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&T2, &T2, NULL)) != MP_OKAY)             goto LBL_ERR;
+
+   /** T1 = T1 - T2; \\ r2 */
+   if ((err = mp_sub(&T1, &T2, &T1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S5 = (S5 - (a0 << 6) - a3 - (T1 << 4) - (T2 << 2))/2; \\ 16*r1 + 4*r3 + r5 */
+   if ((err = mp_mul_2d(&a0, 6, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S5, &S2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&S5, &a3, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&T1, 4, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S5, &S2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_2d(&T2, 2, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S5, &S2, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_2(&S5, &S5)) != MP_OKAY)                     goto LBL_ERR;
+
+   /** S3 = (S3 - S1)/3; \\ r3 + 5*r5 */
+   if ((err = mp_sub(&S3, &S1, &S3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&S3, &S3, NULL)) != MP_OKAY)             goto LBL_ERR;
+
+   /** S5 = (S5 - S1)/3; \\ 5*r1 + r3 */
+   if ((err = mp_sub(&S5, &S1, &S5)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = s_mp_div_3(&S5, &S5, NULL)) != MP_OKAY)             goto LBL_ERR;
+
+   /** S2 = ((S3 << 2) + S5 - 5*S1)/15; \\ r5 */
+   if ((err = mp_mul_2d(&S3, 2, &S2)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_add(&S2, &S5, &S2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_mul_d(&S1, 5u, &S4)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S2, &S4, &S2)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_div_d(&S2, 15u, &S2, NULL)) != MP_OKAY)          goto LBL_ERR;
+
+   /** S3 = S3 - 5*S2; \\ r3 */
+   if ((err = mp_mul_d(&S2, 5u, &S4)) != MP_OKAY)                 goto LBL_ERR;
+   if ((err = mp_sub(&S3, &S4, &S3)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** S1 = S1 - S3 - S2; \\ r1 */
+   if ((err = mp_sub(&S1, &S3, &S1)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_sub(&S1, &S2, &S1)) != MP_OKAY)                  goto LBL_ERR;
+
+   /** P = a3*x^6 + S2*x^5 + T2*x^4 + S3*x^3 + T1*x^2 + S1*x + a0; */
+   if ((err = mp_lshd(&a3, 6 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_lshd(&S2, 5 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &S2, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&T2, 4 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &T2, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&S3, 3 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &S3, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&T1, 2 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &T1, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_lshd(&S1, 1 * B)) != MP_OKAY)                    goto LBL_ERR;
+   if ((err = mp_add(&a3, &S1, &a3)) != MP_OKAY)                  goto LBL_ERR;
+   if ((err = mp_add(&a3, &a0, b)) != MP_OKAY)                    goto LBL_ERR;
+
+LBL_ERR:
+   mp_clear(&a3);
+LBL_ERRa3:
+   mp_clear(&a2);
+LBL_ERRa2:
+   mp_clear(&a1);
+LBL_ERRa1:
+   mp_clear(&a0);
+LBL_ERRa0:
+   mp_clear_multi(&S1, &S2, &S3, &S4, &S5, &T1, &T2, NULL);
+   return err;
+}
+
+#endif
@@ -83,6 +83,15 @@ typedef uint32_t             mp_digit;
 #define MP_PRIME_SAFE     0x0002 /* Safe prime (p-1)/2 == prime */
 #define MP_PRIME_2MSB_ON  0x0008 /* force 2nd MSB to 1 */
 
+/* CPU features, see mp_cpu_features() */
+#define MP_CPU_BMI2        0x0001 /* x86 MULX */
+#define MP_CPU_ADX         0x0002 /* x86 ADCX/ADOX */
+#define MP_CPU_AVX2        0x0004
+#define MP_CPU_AVX512F     0x0008
+#define MP_CPU_AVX512IFMA  0x0010 /* 52 bit multiply-add */
+#define MP_CPU_ASIMD       0x0020 /* aarch64 Advanced SIMD */
+#define MP_CPU_SVE         0x0040 /* aarch64 Scalable Vector Extension */
+
 typedef enum {
    MP_ZPOS = 0,   /* positive */
    MP_NEG = 1     /* negative */
@@ -104,6 +113,12 @@ typedef enum {
    MP_OVF   = -6   /* mp_int overflow, too many digits */
 } mp_err;
 
+/* kernels which are chosen at runtime, see mp_kernel_name() */
+typedef enum {
+   MP_KERNEL_EXPTMOD = 0,
+   MP_KERNEL_EXPTMOD4
+} mp_kernel;
+
 typedef enum {
    MP_LSB_FIRST = -1,
    MP_MSB_FIRST =  1
@@ -121,7 +136,12 @@ extern int
 MP_MUL_KARATSUBA_CUTOFF,
 MP_SQR_KARATSUBA_CUTOFF,
 MP_MUL_TOOM_CUTOFF,
-MP_SQR_TOOM_CUTOFF;
+MP_SQR_TOOM_CUTOFF,
+MP_MUL_TOOM4_CUTOFF,
+MP_SQR_TOOM4_CUTOFF,
+MP_MUL_FFT_CUTOFF,
+MP_SQR_FFT_CUTOFF,
+MP_DIV_NEWTON_CUTOFF;
 #endif
 
 /* define this to use lower memory usage routines (exptmods mostly) */
@@ -181,6 +201,13 @@ typedef struct  {
 /* error code to char* string */
 const char *mp_error_to_string(mp_err code) MP_WUR;
 
+/* ---> runtime CPU dispatch <--- */
+/* MP_CPU_* flags of the host CPU */
+unsigned int mp_cpu_features(void) MP_WUR;
+
+/* name of the implementation chosen for a kernel, NULL for an invalid kernel */
+const char *mp_kernel_name(mp_kernel kernel) MP_WUR;
+
 /* ---> init and deinit bignum functions <--- */
 /* init a bignum */
 mp_err mp_init(mp_int *a) MP_WUR;
@@ -352,6 +379,9 @@ mp_err mp_sub(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 /* c = a * b */
 mp_err mp_mul(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 
+/* c = a * b mod B**n, the low n digits of the product */
+mp_err mp_mul_low(const mp_int *a, const mp_int *b, int n, mp_int *c) MP_WUR;
+
 /* b = a*a  */
 #define mp_sqr(a, b) mp_mul((a), (a), (b))
 
@@ -361,6 +391,24 @@ mp_err mp_div(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d) MP_WUR;
 /* c = a mod b, 0 <= c < b  */
 mp_err mp_mod(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 
+/* c = a/b for b dividing a, c is undefined if it does not */
+mp_err mp_divexact(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+
+/* division context of a divisor N != 0 */
+typedef struct {
+   mp_int N,      /* the divisor */
+          v;      /* B**(2*N.used) / |N|, zero if N is too small for it */
+} mp_div_ctx;
+
+/* sets up a division context for N */
+mp_err mp_div_ctx_init(mp_div_ctx *ctx, const mp_int *N) MP_WUR;
+
+/* frees a division context */
+void mp_div_ctx_clear(mp_div_ctx *ctx);
+
+/* a/N => cN + d == a, as mp_div */
+mp_err mp_div_with_ctx(const mp_int *a, const mp_div_ctx *ctx, mp_int *c, mp_int *d) MP_WUR;
+
 /* Increment "a" by one like "a++". Changes input! */
 #define mp_incr(a) mp_add_d((a), 1u, (a))
 
@@ -387,6 +435,9 @@ mp_err mp_div_d(const mp_int *a, mp_digit b, mp_int *c, mp_digit *d) MP_WUR;
 /* c = a mod b, 0 <= c < b  */
 #define mp_mod_d(a, b, c) mp_div_d((a), (b), NULL, (c))
 
+/* c[i] = a mod b[i] for i < n, 0 <= c[i] < b[i], in one pass over a */
+mp_err mp_mod_d_multi(const mp_int *a, const mp_digit *b, int n, mp_digit *c) MP_WUR;
+
 /* ---> number theory <--- */
 
 /* d = a + b (mod c) */
@@ -447,6 +498,30 @@ mp_err mp_reduce_setup(mp_int *a, const mp_int *b) MP_WUR;
  */
 mp_err mp_reduce(mp_int *x, const mp_int *m, const mp_int *mu) MP_WUR;
 
+/* Barrett context of a modulus N > 0 */
+typedef struct {
+   mp_int N,      /* the modulus */
+          mu;     /* B**(2*N.used) / N */
+} mp_barrett_ctx;
+
+/* sets up a Barrett context for N */
+mp_err mp_barrett_ctx_init(mp_barrett_ctx *ctx, const mp_int *N) MP_WUR;
+
+/* frees a Barrett context */
+void mp_barrett_ctx_clear(mp_barrett_ctx *ctx);
+
+/* c = a mod N, a may be any value */
+mp_err mp_barrett_mod(const mp_int *a, const mp_barrett_ctx *ctx, mp_int *c) MP_WUR;
+
+/* d = a + b mod N */
+mp_err mp_barrett_addmod(const mp_int *a, const mp_int *b, const mp_barrett_ctx *ctx, mp_int *d) MP_WUR;
+
+/* d = a * b mod N */
+mp_err mp_barrett_mulmod(const mp_int *a, const mp_int *b, const mp_barrett_ctx *ctx, mp_int *d) MP_WUR;
+
+/* c = a * a mod N */
+mp_err mp_barrett_sqrmod(const mp_int *a, const mp_barrett_ctx *ctx, mp_int *c) MP_WUR;
+
 /* setups the montgomery reduction */
 mp_err mp_montgomery_setup(const mp_int *n, mp_digit *rho) MP_WUR;
 
@@ -458,6 +533,35 @@ mp_err mp_montgomery_calc_normalization(mp_int *a, const mp_int *b) MP_WUR;
 /* computes x/R == x (mod N) via Montgomery Reduction */
 mp_err mp_montgomery_reduce(mp_int *x, const mp_int *n, mp_digit rho) MP_WUR;
 
+/* Montgomery context of an odd modulus N > 1, R = B**N.used */
+typedef struct {
+   mp_int N,      /* the modulus */
+          R,      /* R mod N, 1 in Montgomery form */
+          RR;     /* R**2 mod N */
+   mp_digit rho;  /* -1/N mod B */
+} mp_mont_ctx;
+
+/* sets up a Montgomery context for N */
+mp_err mp_mont_ctx_init(mp_mont_ctx *ctx, const mp_int *N) MP_WUR;
+
+/* frees a Montgomery context */
+void mp_mont_ctx_clear(mp_mont_ctx *ctx);
+
+/* c = a*R mod N, a may be any value */
+mp_err mp_to_mont(const mp_int *a, const mp_mont_ctx *ctx, mp_int *c) MP_WUR;
+
+/* c = a/R mod N, 0 <= a < N */
+mp_err mp_from_mont(const mp_int *a, const mp_mont_ctx *ctx, mp_int *c) MP_WUR;
+
+/* c = a*b/R mod N, 0 <= a, b < N */
+mp_err mp_mont_mul(const mp_int *a, const mp_int *b, const mp_mont_ctx *ctx, mp_int *c) MP_WUR;
+
+/* c = a*a/R mod N, 0 <= a < N */
+mp_err mp_mont_sqr(const mp_int *a, const mp_mont_ctx *ctx, mp_int *c) MP_WUR;
+
+/* c = a**e/R**(e-1) mod N, i.e. the power in Montgomery form, 0 <= a < N and e >= 0 */
+mp_err mp_mont_exp(const mp_int *a, const mp_int *e, const mp_mont_ctx *ctx, mp_int *c) MP_WUR;
+
 /* returns 1 if a is a valid DR modulus */
 bool mp_dr_is_modulus(const mp_int *a) MP_WUR;
 
@@ -476,6 +580,17 @@ mp_err mp_reduce_2k_setup(const mp_int *a, mp_digit *d) MP_WUR;
 /* reduces a modulo b where b is of the form 2**p - k [0 <= a] */
 mp_err mp_reduce_2k(mp_int *a, const mp_int *n, mp_digit d) MP_WUR;
 
+/* returns true if a is one of the primes mp_reduce_special knows */
+bool mp_reduce_is_special(const mp_int *a) MP_WUR;
+
+/* determines the index of the prime a for mp_reduce_special */
+mp_err mp_reduce_special_setup(const mp_int *a, mp_digit *d) MP_WUR;
+
+/* reduces a modulo n, one of P-256, P-384, P-521, 2**255 - 19 and secp256k1, any a is accepted,
+ * values outside of [0, 2**(2*bits(n))) go through mp_mod
+ */
+mp_err mp_reduce_special(mp_int *a, const mp_int *n, mp_digit d) MP_WUR;
+
 /* returns true if a can be reduced with mp_reduce_2k_l */
 bool mp_reduce_is_2k_l(const mp_int *a) MP_WUR;
 
@@ -488,6 +603,48 @@ mp_err mp_reduce_2k_l(mp_int *a, const mp_int *n, const mp_int *d) MP_WUR;
 /* Y = G**X (mod P) */
 mp_err mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y) MP_WUR;
 
+/* Y = G**e (mod P) */
+mp_err mp_exptmod_d(const mp_int *G, uint32_t e, const mp_int *P, mp_int *Y) MP_WUR;
+
+/* Y = G**X (mod P) for odd P, in constant time with respect to the value of X >= 0 */
+mp_err mp_exptmod_ct(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y) MP_WUR;
+
+/* Y = G[0]**X[0] * G[1]**X[1] * ... * G[n-1]**X[n-1] (mod P) */
+mp_err mp_exptmod_multi(const mp_int *const G[], const mp_int *const X[], int n, const mp_int *P, mp_int *Y) MP_WUR;
+
+/* M = C**d (mod p*q) from dp = d mod (p-1), dq = d mod (q-1) and qinv = q**-1 mod p,
+ * the two exponentiations run on two threads if threads is true and the platform has them
+ */
+mp_err mp_exptmod_crt(const mp_int *C, const mp_int *p, const mp_int *q, const mp_int *dp, const mp_int *dq,
+                      const mp_int *qinv, bool threads, mp_int *M) MP_WUR;
+
+/* Y[i] = G[i]**X[i] (mod P[i]) for i < n, spread over up to nthreads threads */
+mp_err mp_exptmod_batch(const mp_int *const G[], const mp_int *const X[], const mp_int *const P[], mp_int *const Y[],
+                        int n, int nthreads) MP_WUR;
+
+/* fixed-base comb table (Lim-Lee) of G mod P, P odd, for exponents of up to teeth*spacing bits */
+typedef struct {
+   mp_mont_ctx ctx;   /* Montgomery context of P */
+   int teeth,         /* exponent bits per table lookup */
+       spacing,       /* distance of those bits, the number of squarings */
+       width;         /* digits per table entry, P.used */
+   mp_digit *tab;     /* 2**teeth entries in Montgomery form */
+} mp_fixed_base;
+
+/* builds the table of G mod P for exponents of up to bits bits */
+mp_err mp_fixed_base_init(mp_fixed_base *fb, const mp_int *G, const mp_int *P, int bits) MP_WUR;
+
+/* frees a fixed-base table */
+void mp_fixed_base_clear(mp_fixed_base *fb);
+
+/* Y = G**X (mod P) */
+mp_err mp_fixed_base_exptmod(const mp_fixed_base *fb, const mp_int *X, mp_int *Y) MP_WUR;
+
+/* size, export and import of the serialized table */
+size_t mp_fixed_base_bin_size(const mp_fixed_base *fb) MP_WUR;
+mp_err mp_fixed_base_to_bin(const mp_fixed_base *fb, uint8_t *buf, size_t maxlen, size_t *written) MP_WUR;
+mp_err mp_fixed_base_from_bin(mp_fixed_base *fb, const uint8_t *buf, size_t size) MP_WUR;
+
 /* ---> Primes <--- */
 
 /* performs one Fermat test of "a" using base "b".
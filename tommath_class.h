@@ -17,6 +17,12 @@
 #   define MP_ADD_D_C
 #   define MP_ADDMOD_C
 #   define MP_AND_C
+#   define MP_BARRETT_ADDMOD_C
+#   define MP_BARRETT_CTX_CLEAR_C
+#   define MP_BARRETT_CTX_INIT_C
+#   define MP_BARRETT_MOD_C
+#   define MP_BARRETT_MULMOD_C
+#   define MP_BARRETT_SQRMOD_C
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
 #   define MP_CLEAR_MULTI_C
@@ -27,11 +33,16 @@
 #   define MP_COMPLEMENT_C
 #   define MP_COPY_C
 #   define MP_COUNT_BITS_C
+#   define MP_CPU_FEATURES_C
 #   define MP_CUTOFFS_C
 #   define MP_DIV_C
 #   define MP_DIV_2_C
 #   define MP_DIV_2D_C
+#   define MP_DIV_CTX_CLEAR_C
+#   define MP_DIV_CTX_INIT_C
 #   define MP_DIV_D_C
+#   define MP_DIV_WITH_CTX_C
+#   define MP_DIVEXACT_C
 #   define MP_DR_IS_MODULUS_C
 #   define MP_DR_REDUCE_C
 #   define MP_DR_SETUP_C
@@ -39,8 +50,20 @@
 #   define MP_EXCH_C
 #   define MP_EXPT_N_C
 #   define MP_EXPTMOD_C
+#   define MP_EXPTMOD_BATCH_C
+#   define MP_EXPTMOD_CRT_C
+#   define MP_EXPTMOD_CT_C
+#   define MP_EXPTMOD_D_C
+#   define MP_EXPTMOD_MULTI_C
 #   define MP_EXTEUCLID_C
+#   define MP_FIXED_BASE_BIN_SIZE_C
+#   define MP_FIXED_BASE_CLEAR_C
+#   define MP_FIXED_BASE_EXPTMOD_C
+#   define MP_FIXED_BASE_FROM_BIN_C
+#   define MP_FIXED_BASE_INIT_C
+#   define MP_FIXED_BASE_TO_BIN_C
 #   define MP_FREAD_C
+#   define MP_FROM_MONT_C
 #   define MP_FROM_SBIN_C
 #   define MP_FROM_UBIN_C
 #   define MP_FWRITE_C
@@ -66,12 +89,19 @@
 #   define MP_INIT_UL_C
 #   define MP_INVMOD_C
 #   define MP_IS_SQUARE_C
+#   define MP_KERNEL_NAME_C
 #   define MP_KRONECKER_C
 #   define MP_LCM_C
 #   define MP_LOG_N_C
 #   define MP_LSHD_C
 #   define MP_MOD_C
 #   define MP_MOD_2D_C
+#   define MP_MOD_D_MULTI_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_EXP_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
 #   define MP_MONTGOMERY_CALC_NORMALIZATION_C
 #   define MP_MONTGOMERY_REDUCE_C
 #   define MP_MONTGOMERY_SETUP_C
@@ -79,6 +109,7 @@
 #   define MP_MUL_2_C
 #   define MP_MUL_2D_C
 #   define MP_MUL_D_C
+#   define MP_MUL_LOW_C
 #   define MP_MULMOD_C
 #   define MP_NEG_C
 #   define MP_OR_C
@@ -103,7 +134,10 @@
 #   define MP_REDUCE_2K_SETUP_L_C
 #   define MP_REDUCE_IS_2K_C
 #   define MP_REDUCE_IS_2K_L_C
+#   define MP_REDUCE_IS_SPECIAL_C
 #   define MP_REDUCE_SETUP_C
+#   define MP_REDUCE_SPECIAL_C
+#   define MP_REDUCE_SPECIAL_SETUP_C
 #   define MP_ROOT_N_C
 #   define MP_RSHD_C
 #   define MP_SBIN_SIZE_C
@@ -123,6 +157,7 @@
 #   define MP_SUB_C
 #   define MP_SUB_D_C
 #   define MP_SUBMOD_C
+#   define MP_TO_MONT_C
 #   define MP_TO_RADIX_C
 #   define MP_TO_SBIN_C
 #   define MP_TO_UBIN_C
@@ -132,15 +167,29 @@
 #   define MP_ZERO_C
 #   define S_MP_ADD_C
 #   define S_MP_COPY_DIGS_C
+#   define S_MP_DIGIT_RECIP_C
 #   define S_MP_DIV_3_C
+#   define S_MP_DIV_D_RECIP_C
+#   define S_MP_DIV_NEWTON_C
+#   define S_MP_DIV_RECIP_C
 #   define S_MP_DIV_RECURSIVE_C
 #   define S_MP_DIV_SCHOOL_C
 #   define S_MP_DIV_SMALL_C
+#   define S_MP_DIVEXACT_HENSEL_C
+#   define S_MP_DIVEXACT_SCHOOL_C
 #   define S_MP_EXPTMOD_C
+#   define S_MP_EXPTMOD4_AVX2_C
+#   define S_MP_EXPTMOD_EVEN_C
 #   define S_MP_EXPTMOD_FAST_C
+#   define S_MP_EXPTMOD_IFMA_C
+#   define S_MP_EXPTMOD_SETUP_C
+#   define S_MP_EXPTMOD_TABLE_C
+#   define S_MP_FIXED_BASE_GET_C
+#   define S_MP_FIXED_BASE_SET_C
 #   define S_MP_GET_BIT_C
 #   define S_MP_INVMOD_C
 #   define S_MP_INVMOD_ODD_C
+#   define S_MP_KERNELS_C
 #   define S_MP_LOG_C
 #   define S_MP_LOG_2EXPT_C
 #   define S_MP_LOG_D_C
@@ -148,20 +197,29 @@
 #   define S_MP_MUL_C
 #   define S_MP_MUL_BALANCE_C
 #   define S_MP_MUL_COMBA_C
+#   define S_MP_MUL_FFT_C
 #   define S_MP_MUL_HIGH_C
 #   define S_MP_MUL_HIGH_COMBA_C
 #   define S_MP_MUL_KARATSUBA_C
+#   define S_MP_MUL_MULDERS_C
 #   define S_MP_MUL_TOOM_C
+#   define S_MP_MUL_TOOM32_C
+#   define S_MP_MUL_TOOM4_C
+#   define S_MP_MUL_TOOM43_C
+#   define S_MP_PARALLEL_C
 #   define S_MP_PRIME_IS_DIVISIBLE_C
 #   define S_MP_PRIME_TAB_C
 #   define S_MP_RADIX_MAP_C
 #   define S_MP_RADIX_SIZE_OVERESTIMATE_C
 #   define S_MP_RAND_JENKINS_C
 #   define S_MP_RAND_PLATFORM_C
+#   define S_MP_SPECIAL_PRIME_C
 #   define S_MP_SQR_C
 #   define S_MP_SQR_COMBA_C
+#   define S_MP_SQR_FFT_C
 #   define S_MP_SQR_KARATSUBA_C
 #   define S_MP_SQR_TOOM_C
+#   define S_MP_SQR_TOOM4_C
 #   define S_MP_SUB_C
 #   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
@@ -199,6 +257,42 @@
 #   define MP_GROW_C
 #endif
 
+#if defined(MP_BARRETT_ADDMOD_C)
+#   define MP_ADD_C
+#   define MP_BARRETT_MOD_C
+#   define MP_CMP_MAG_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(MP_BARRETT_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#endif
+
+#if defined(MP_BARRETT_CTX_INIT_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_INIT_MULTI_C
+#   define MP_REDUCE_SETUP_C
+#endif
+
+#if defined(MP_BARRETT_MOD_C)
+#   define MP_ABS_C
+#   define MP_CMP_MAG_C
+#   define MP_MOD_C
+#   define MP_REDUCE_C
+#   define MP_SUB_C
+#endif
+
+#if defined(MP_BARRETT_MULMOD_C)
+#   define MP_BARRETT_MOD_C
+#   define MP_MUL_C
+#endif
+
+#if defined(MP_BARRETT_SQRMOD_C)
+#   define MP_BARRETT_MOD_C
+#   define MP_MUL_C
+#endif
+
 #if defined(MP_CLAMP_C)
 #endif
 
@@ -236,6 +330,9 @@
 #if defined(MP_COUNT_BITS_C)
 #endif
 
+#if defined(MP_CPU_FEATURES_C)
+#endif
+
 #if defined(MP_CUTOFFS_C)
 #endif
 
@@ -243,6 +340,7 @@
 #   define MP_CMP_MAG_C
 #   define MP_COPY_C
 #   define MP_ZERO_C
+#   define S_MP_DIV_NEWTON_C
 #   define S_MP_DIV_RECURSIVE_C
 #   define S_MP_DIV_SCHOOL_C
 #   define S_MP_DIV_SMALL_C
@@ -261,6 +359,17 @@
 #   define MP_RSHD_C
 #endif
 
+#if defined(MP_DIV_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#endif
+
+#if defined(MP_DIV_CTX_INIT_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_INIT_MULTI_C
+#   define S_MP_DIV_RECIP_C
+#endif
+
 #if defined(MP_DIV_D_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
@@ -269,7 +378,27 @@
 #   define MP_DIV_2_C
 #   define MP_EXCH_C
 #   define MP_INIT_SIZE_C
+#   define S_MP_DIGIT_RECIP_C
 #   define S_MP_DIV_3_C
+#   define S_MP_DIV_D_RECIP_C
+#endif
+
+#if defined(MP_DIV_WITH_CTX_C)
+#   define MP_CMP_MAG_C
+#   define MP_DIV_C
+#   define S_MP_DIV_NEWTON_C
+#endif
+
+#if defined(MP_DIVEXACT_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_D_C
+#   define MP_CNT_LSB_C
+#   define MP_DIV_2D_C
+#   define MP_DIV_C
+#   define MP_EXCH_C
+#   define MP_INIT_MULTI_C
+#   define S_MP_DIVEXACT_HENSEL_C
+#   define S_MP_DIVEXACT_SCHOOL_C
 #endif
 
 #if defined(MP_DR_IS_MODULUS_C)
@@ -302,15 +431,110 @@
 #if defined(MP_EXPTMOD_C)
 #   define MP_ABS_C
 #   define MP_CLEAR_MULTI_C
+#   define MP_COUNT_BITS_C
 #   define MP_DR_IS_MODULUS_C
+#   define MP_EXPTMOD_D_C
+#   define MP_GET_I32_C
 #   define MP_INIT_MULTI_C
 #   define MP_INVMOD_C
 #   define MP_REDUCE_IS_2K_C
 #   define MP_REDUCE_IS_2K_L_C
+#   define MP_REDUCE_IS_SPECIAL_C
 #   define S_MP_EXPTMOD_C
+#   define S_MP_EXPTMOD_EVEN_C
 #   define S_MP_EXPTMOD_FAST_C
 #endif
 
+#if defined(MP_EXPTMOD_BATCH_C)
+#   define MP_CLEAR_C
+#   define MP_CMP_C
+#   define MP_CMP_D_C
+#   define MP_COUNT_BITS_C
+#   define MP_DR_IS_MODULUS_C
+#   define MP_EXPTMOD_C
+#   define MP_FROM_MONT_C
+#   define MP_INIT_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_EXP_C
+#   define MP_REDUCE_IS_2K_C
+#   define MP_TO_MONT_C
+#   define S_MP_KERNELS_C
+#   define S_MP_PARALLEL_C
+#endif
+
+#if defined(MP_EXPTMOD_CRT_C)
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_D_C
+#   define MP_INIT_MULTI_C
+#   define MP_MULMOD_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_PARALLEL_C
+#endif
+
+#if defined(MP_EXPTMOD_CT_C)
+#   define MP_2EXPT_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CMP_D_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_ZERO_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_EXPTMOD_D_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_DR_IS_MODULUS_C
+#   define MP_EXCH_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_C
+#   define MP_REDUCE_C
+#   define MP_REDUCE_IS_2K_C
+#   define MP_REDUCE_IS_SPECIAL_C
+#   define MP_REDUCE_SETUP_C
+#   define MP_SET_C
+#   define MP_SET_U32_C
+#   define S_MP_EXPTMOD_SETUP_C
+#   define S_MP_KERNELS_C
+#endif
+
+#if defined(MP_EXPTMOD_MULTI_C)
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_DR_IS_MODULUS_C
+#   define MP_EXCH_C
+#   define MP_EXPTMOD_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_INVMOD_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_CALC_NORMALIZATION_C
+#   define MP_MULMOD_C
+#   define MP_MUL_C
+#   define MP_REDUCE_IS_2K_C
+#   define MP_SET_C
+#   define S_MP_EXPTMOD_SETUP_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_KERNELS_C
+#   define S_MP_MULTI_BASE_C
+#endif
+
 #if defined(MP_EXTEUCLID_C)
 #   define MP_CLEAR_MULTI_C
 #   define MP_COPY_C
@@ -323,12 +547,77 @@
 #   define MP_SUB_C
 #endif
 
+#if defined(MP_FIXED_BASE_BIN_SIZE_C)
+#   define MP_UBIN_SIZE_C
+#endif
+
+#if defined(MP_FIXED_BASE_CLEAR_C)
+#   define MP_MONT_CTX_CLEAR_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_FIXED_BASE_EXPTMOD_C)
+#   define MP_CLEAR_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_EXPTMOD_C
+#   define MP_FROM_MONT_C
+#   define MP_INIT_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_SET_C
+#   define S_MP_FIXED_BASE_GET_C
+#   define S_MP_GET_BIT_C
+#endif
+
+#if defined(MP_FIXED_BASE_FROM_BIN_C)
+#   define MP_CLEAR_C
+#   define MP_CMP_C
+#   define MP_FROM_UBIN_C
+#   define MP_INIT_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_TO_MONT_C
+#   define S_MP_FIXED_BASE_SET_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_FIXED_BASE_INIT_C)
+#   define MP_CLEAR_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_TO_MONT_C
+#   define S_MP_FIXED_BASE_GET_C
+#   define S_MP_FIXED_BASE_SET_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_FIXED_BASE_TO_BIN_C)
+#   define MP_CLEAR_C
+#   define MP_FIXED_BASE_BIN_SIZE_C
+#   define MP_FROM_MONT_C
+#   define MP_INIT_SIZE_C
+#   define MP_TO_UBIN_C
+#   define MP_UBIN_SIZE_C
+#   define S_MP_FIXED_BASE_GET_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
 #if defined(MP_FREAD_C)
 #   define MP_ADD_D_C
 #   define MP_MUL_D_C
 #   define MP_ZERO_C
 #endif
 
+#if defined(MP_FROM_MONT_C)
+#   define MP_COPY_C
+#   define MP_MONTGOMERY_REDUCE_C
+#endif
+
 #if defined(MP_FROM_SBIN_C)
 #   define MP_FROM_UBIN_C
 #endif
@@ -456,6 +745,10 @@
 #   define MP_SQRT_C
 #endif
 
+#if defined(MP_KERNEL_NAME_C)
+#   define S_MP_KERNELS_C
+#endif
+
 #if defined(MP_KRONECKER_C)
 #   define MP_CLEAR_C
 #   define MP_CMP_D_C
@@ -470,7 +763,7 @@
 #if defined(MP_LCM_C)
 #   define MP_CLEAR_MULTI_C
 #   define MP_CMP_MAG_C
-#   define MP_DIV_C
+#   define MP_DIVEXACT_C
 #   define MP_GCD_C
 #   define MP_INIT_MULTI_C
 #   define MP_MUL_C
@@ -499,6 +792,49 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(MP_MOD_D_MULTI_C)
+#   define MP_DIV_D_C
+#endif
+
+#if defined(MP_MONT_CTX_CLEAR_C)
+#   define MP_CLEAR_MULTI_C
+#endif
+
+#if defined(MP_MONT_CTX_INIT_C)
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_D_C
+#   define MP_COPY_C
+#   define MP_INIT_MULTI_C
+#   define MP_MONTGOMERY_CALC_NORMALIZATION_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_MULMOD_C
+#endif
+
+#if defined(MP_MONT_EXP_C)
+#   define MP_CLEAR_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_FROM_MONT_C
+#   define MP_INIT_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONT_MUL_C
+#   define MP_MONT_SQR_C
+#   define MP_TO_MONT_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_KERNELS_C
+#endif
+
+#if defined(MP_MONT_MUL_C)
+#   define MP_MONTGOMERY_REDUCE_C
+#   define MP_MUL_C
+#endif
+
+#if defined(MP_MONT_SQR_C)
+#   define MP_MONTGOMERY_REDUCE_C
+#   define MP_MUL_C
+#endif
+
 #if defined(MP_MONTGOMERY_CALC_NORMALIZATION_C)
 #   define MP_2EXPT_C
 #   define MP_CMP_MAG_C
@@ -524,11 +860,17 @@
 #   define S_MP_MUL_BALANCE_C
 #   define S_MP_MUL_C
 #   define S_MP_MUL_COMBA_C
+#   define S_MP_MUL_FFT_C
 #   define S_MP_MUL_KARATSUBA_C
+#   define S_MP_MUL_TOOM32_C
+#   define S_MP_MUL_TOOM43_C
+#   define S_MP_MUL_TOOM4_C
 #   define S_MP_MUL_TOOM_C
 #   define S_MP_SQR_C
 #   define S_MP_SQR_COMBA_C
+#   define S_MP_SQR_FFT_C
 #   define S_MP_SQR_KARATSUBA_C
+#   define S_MP_SQR_TOOM4_C
 #   define S_MP_SQR_TOOM_C
 #endif
 
@@ -553,9 +895,17 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(MP_MUL_LOW_C)
+#   define MP_MUL_C
+#   define S_MP_MUL_C
+#   define S_MP_MUL_MULDERS_C
+#endif
+
 #if defined(MP_MULMOD_C)
 #   define MP_MOD_C
 #   define MP_MUL_C
+#   define MP_REDUCE_SPECIAL_C
+#   define MP_REDUCE_SPECIAL_SETUP_C
 #endif
 
 #if defined(MP_NEG_C)
@@ -624,27 +974,35 @@
 #endif
 
 #if defined(MP_PRIME_MILLER_RABIN_C)
-#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
 #   define MP_CMP_C
 #   define MP_CMP_D_C
 #   define MP_CNT_LSB_C
+#   define MP_COPY_C
 #   define MP_DIV_2D_C
 #   define MP_EXPTMOD_C
-#   define MP_INIT_C
-#   define MP_INIT_COPY_C
+#   define MP_INIT_MULTI_C
+#   define MP_MONT_CTX_CLEAR_C
+#   define MP_MONT_CTX_INIT_C
+#   define MP_MONT_EXP_C
+#   define MP_MONT_SQR_C
+#   define MP_SET_C
 #   define MP_SQRMOD_C
+#   define MP_SUB_C
 #   define MP_SUB_D_C
+#   define MP_TO_MONT_C
 #endif
 
 #if defined(MP_PRIME_NEXT_PRIME_C)
 #   define MP_ADD_D_C
 #   define MP_CLEAR_C
 #   define MP_CMP_D_C
-#   define MP_DIV_D_C
 #   define MP_INIT_C
+#   define MP_MOD_D_MULTI_C
 #   define MP_PRIME_IS_PRIME_C
 #   define MP_SET_C
 #   define MP_SUB_D_C
+#   define S_MP_DIV_D_RECIP_C
 #endif
 
 #if defined(MP_PRIME_RABIN_MILLER_TRIALS_C)
@@ -719,10 +1077,10 @@
 #   define MP_LSHD_C
 #   define MP_MOD_2D_C
 #   define MP_MUL_C
+#   define MP_MUL_LOW_C
 #   define MP_RSHD_C
 #   define MP_SET_C
 #   define MP_SUB_C
-#   define S_MP_MUL_C
 #   define S_MP_MUL_HIGH_C
 #   define S_MP_MUL_HIGH_COMBA_C
 #   define S_MP_SUB_C
@@ -773,11 +1131,29 @@
 #if defined(MP_REDUCE_IS_2K_L_C)
 #endif
 
+#if defined(MP_REDUCE_IS_SPECIAL_C)
+#   define MP_REDUCE_SPECIAL_SETUP_C
+#endif
+
 #if defined(MP_REDUCE_SETUP_C)
 #   define MP_2EXPT_C
 #   define MP_DIV_C
 #endif
 
+#if defined(MP_REDUCE_SPECIAL_C)
+#   define MP_CLAMP_C
+#   define MP_COUNT_BITS_C
+#   define MP_GROW_C
+#   define MP_MOD_C
+#   define S_MP_SPECIAL_PRIME_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(MP_REDUCE_SPECIAL_SETUP_C)
+#   define MP_COUNT_BITS_C
+#   define S_MP_SPECIAL_PRIME_C
+#endif
+
 #if defined(MP_ROOT_N_C)
 #   define MP_2EXPT_C
 #   define MP_ADD_D_C
@@ -851,6 +1227,8 @@
 #if defined(MP_SQRMOD_C)
 #   define MP_MOD_C
 #   define MP_MUL_C
+#   define MP_REDUCE_SPECIAL_C
+#   define MP_REDUCE_SPECIAL_SETUP_C
 #endif
 
 #if defined(MP_SQRT_C)
@@ -901,6 +1279,13 @@
 #   define MP_SUB_C
 #endif
 
+#if defined(MP_TO_MONT_C)
+#   define MP_CMP_MAG_C
+#   define MP_MOD_C
+#   define MP_MONTGOMERY_REDUCE_C
+#   define MP_MUL_C
+#endif
+
 #if defined(MP_TO_RADIX_C)
 #   define MP_CLEAR_C
 #   define MP_DIV_D_C
@@ -946,6 +1331,9 @@
 #if defined(S_MP_COPY_DIGS_C)
 #endif
 
+#if defined(S_MP_DIGIT_RECIP_C)
+#endif
+
 #if defined(S_MP_DIV_3_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
@@ -953,6 +1341,49 @@
 #   define MP_INIT_SIZE_C
 #endif
 
+#if defined(S_MP_DIV_D_RECIP_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_EXCH_C
+#   define MP_INIT_SIZE_C
+#endif
+
+#if defined(S_MP_DIV_NEWTON_C)
+#   define MP_2EXPT_C
+#   define MP_ABS_C
+#   define MP_ADD_C
+#   define MP_ADD_D_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_C
+#   define MP_CMP_MAG_C
+#   define MP_DIV_2D_C
+#   define MP_EXCH_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MOD_2D_C
+#   define MP_MUL_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#   define MP_SUB_D_C
+#   define S_MP_ADD_C
+#   define S_MP_DIV_RECIP_C
+#   define S_MP_SUB_C
+#endif
+
+#if defined(S_MP_DIV_RECIP_C)
+#   define MP_2EXPT_C
+#   define MP_ADD_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2D_C
+#   define MP_DIV_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MUL_C
+#   define MP_RSHD_C
+#   define MP_SUB_C
+#endif
+
 #if defined(S_MP_DIV_RECURSIVE_C)
 #   define MP_ADD_C
 #   define MP_CLEAR_MULTI_C
@@ -1005,12 +1436,46 @@
 #   define MP_SUB_C
 #endif
 
+#if defined(S_MP_DIVEXACT_HENSEL_C)
+#   define MP_2EXPT_C
+#   define MP_ADD_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2D_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MOD_2D_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_MUL_C
+#   define MP_MUL_LOW_C
+#   define MP_RSHD_C
+#   define MP_SET_C
+#   define MP_SUB_C
+#   define MP_ZERO_C
+#   define S_MP_ADD_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_DIVEXACT_SCHOOL_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_EXCH_C
+#   define MP_INIT_COPY_C
+#   define MP_INIT_SIZE_C
+#   define MP_MONTGOMERY_SETUP_C
+#   define MP_ZERO_C
+#endif
+
 #if defined(S_MP_EXPTMOD_C)
 #   define MP_CLEAR_C
 #   define MP_COPY_C
 #   define MP_COUNT_BITS_C
 #   define MP_EXCH_C
 #   define MP_INIT_C
+#   define MP_INIT_SIZE_C
 #   define MP_MOD_C
 #   define MP_MUL_C
 #   define MP_REDUCE_2K_L_C
@@ -1018,28 +1483,115 @@
 #   define MP_REDUCE_C
 #   define MP_REDUCE_SETUP_C
 #   define MP_SET_C
+#   define S_MP_EXPTMOD_TABLE_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
+#if defined(S_MP_EXPTMOD4_AVX2_C)
+#   define MP_2EXPT_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_MAG_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_MOD_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_SUB_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_EXPTMOD_EVEN_C)
+#   define MP_2EXPT_C
+#   define MP_ADD_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_CMP_D_C
+#   define MP_CNT_LSB_C
+#   define MP_COPY_C
+#   define MP_COUNT_BITS_C
+#   define MP_DIV_2D_C
+#   define MP_EXCH_C
+#   define MP_EXPTMOD_C
+#   define MP_GET_I32_C
+#   define MP_INIT_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_INVMOD_C
+#   define MP_MOD_2D_C
+#   define MP_MOD_C
+#   define MP_MUL_C
+#   define MP_MUL_LOW_C
+#   define MP_SET_C
+#   define MP_SUB_C
+#   define MP_ZERO_C
+#   define S_MP_EXPTMOD_TABLE_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_ZERO_BUF_C
 #endif
 
 #if defined(S_MP_EXPTMOD_FAST_C)
 #   define MP_CLEAR_C
 #   define MP_COPY_C
 #   define MP_COUNT_BITS_C
-#   define MP_DR_REDUCE_C
-#   define MP_DR_SETUP_C
 #   define MP_EXCH_C
 #   define MP_INIT_SIZE_C
 #   define MP_MOD_C
 #   define MP_MONTGOMERY_CALC_NORMALIZATION_C
-#   define MP_MONTGOMERY_REDUCE_C
-#   define MP_MONTGOMERY_SETUP_C
 #   define MP_MULMOD_C
 #   define MP_MUL_C
+#   define MP_SET_C
+#   define S_MP_EXPTMOD_SETUP_C
+#   define S_MP_EXPTMOD_TABLE_C
+#   define S_MP_KERNELS_C
+#   define S_MP_ZERO_BUF_C
+#endif
+
+#if defined(S_MP_EXPTMOD_IFMA_C)
+#   define MP_2EXPT_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CMP_MAG_C
+#   define MP_COUNT_BITS_C
+#   define MP_EXCH_C
+#   define MP_GROW_C
+#   define MP_INIT_C
+#   define MP_MOD_C
+#   define S_MP_GET_BIT_C
+#   define S_MP_SUB_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_EXPTMOD_SETUP_C)
+#   define MP_DR_REDUCE_C
+#   define MP_DR_SETUP_C
+#   define MP_MONTGOMERY_REDUCE_C
+#   define MP_MONTGOMERY_SETUP_C
 #   define MP_REDUCE_2K_C
 #   define MP_REDUCE_2K_SETUP_C
-#   define MP_SET_C
+#   define MP_REDUCE_SPECIAL_C
+#   define MP_REDUCE_SPECIAL_SETUP_C
 #   define S_MP_MONTGOMERY_REDUCE_COMBA_C
 #endif
 
+#if defined(S_MP_EXPTMOD_TABLE_C)
+#endif
+
+#if defined(S_MP_FIXED_BASE_GET_C)
+#   define MP_CLAMP_C
+#   define MP_GROW_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
+#if defined(S_MP_FIXED_BASE_SET_C)
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
 #if defined(S_MP_GET_BIT_C)
 #endif
 
@@ -1073,6 +1625,10 @@
 #   define MP_SUB_C
 #endif
 
+#if defined(S_MP_KERNELS_C)
+#   define MP_CPU_FEATURES_C
+#endif
+
 #if defined(S_MP_LOG_C)
 #   define MP_CLEAR_MULTI_C
 #   define MP_CMP_C
@@ -1097,7 +1653,6 @@
 #   define MP_CMP_MAG_C
 #   define MP_GROW_C
 #   define S_MP_SUB_C
-#   define S_MP_ZERO_BUF_C
 #   define S_MP_ZERO_DIGS_C
 #endif
 
@@ -1128,6 +1683,13 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_MUL_FFT_C)
+#   define MP_CLAMP_C
+#   define MP_GROW_C
+#   define S_MP_ZERO_BUF_C
+#   define S_MP_ZERO_DIGS_C
+#endif
+
 #if defined(S_MP_MUL_HIGH_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
@@ -1154,6 +1716,21 @@
 #   define S_MP_SUB_C
 #endif
 
+#if defined(S_MP_MUL_MULDERS_C)
+#   define MP_CLAMP_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_GROW_C
+#   define MP_INIT_MULTI_C
+#   define MP_LSHD_C
+#   define MP_MOD_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_MUL_LOW_C
+#   define MP_ZERO_C
+#   define S_MP_ADD_C
+#   define S_MP_COPY_DIGS_C
+#endif
+
 #if defined(S_MP_MUL_TOOM_C)
 #   define MP_ADD_C
 #   define MP_CLAMP_C
@@ -1170,8 +1747,66 @@
 #   define S_MP_DIV_3_C
 #endif
 
-#if defined(S_MP_PRIME_IS_DIVISIBLE_C)
+#if defined(S_MP_MUL_TOOM32_C)
+#   define MP_ADD_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_LSHD_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_COPY_DIGS_C
+#endif
+
+#if defined(S_MP_MUL_TOOM4_C)
+#   define MP_ADD_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2D_C
+#   define MP_DIV_2_C
 #   define MP_DIV_D_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_LSHD_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_MUL_D_C
+#   define MP_SUB_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_DIV_3_C
+#endif
+
+#if defined(S_MP_MUL_TOOM43_C)
+#   define MP_ADD_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2D_C
+#   define MP_DIV_2_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_LSHD_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_SUB_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_DIV_3_C
+#endif
+
+#if defined(S_MP_PARALLEL_C)
+#   define MP_BUF_C
+#   define S_MP_KERNELS_C
+#endif
+
+#if defined(S_MP_PRIME_IS_DIVISIBLE_C)
+#   define MP_MOD_D_MULTI_C
+#   define S_MP_DIV_D_RECIP_C
 #endif
 
 #if defined(S_MP_PRIME_TAB_C)
@@ -1198,6 +1833,9 @@
 #if defined(S_MP_RAND_PLATFORM_C)
 #endif
 
+#if defined(S_MP_SPECIAL_PRIME_C)
+#endif
+
 #if defined(S_MP_SQR_C)
 #   define MP_CLAMP_C
 #   define MP_CLEAR_C
@@ -1211,6 +1849,10 @@
 #   define S_MP_ZERO_DIGS_C
 #endif
 
+#if defined(S_MP_SQR_FFT_C)
+#   define S_MP_MUL_FFT_C
+#endif
+
 #if defined(S_MP_SQR_KARATSUBA_C)
 #   define MP_ADD_C
 #   define MP_CLAMP_C
@@ -1237,6 +1879,26 @@
 #   define S_MP_COPY_DIGS_C
 #endif
 
+#if defined(S_MP_SQR_TOOM4_C)
+#   define MP_ADD_C
+#   define MP_CLAMP_C
+#   define MP_CLEAR_C
+#   define MP_CLEAR_MULTI_C
+#   define MP_DIV_2D_C
+#   define MP_DIV_2_C
+#   define MP_DIV_D_C
+#   define MP_INIT_MULTI_C
+#   define MP_INIT_SIZE_C
+#   define MP_LSHD_C
+#   define MP_MUL_2D_C
+#   define MP_MUL_2_C
+#   define MP_MUL_C
+#   define MP_MUL_D_C
+#   define MP_SUB_C
+#   define S_MP_COPY_DIGS_C
+#   define S_MP_DIV_3_C
+#endif
+
 #if defined(S_MP_SUB_C)
 #   define MP_CLAMP_C
 #   define MP_GROW_C
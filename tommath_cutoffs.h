@@ -11,3 +11,8 @@
 #define MP_DEFAULT_SQR_KARATSUBA_CUTOFF 120
 #define MP_DEFAULT_MUL_TOOM_CUTOFF      350
 #define MP_DEFAULT_SQR_TOOM_CUTOFF      400
+#define MP_DEFAULT_MUL_TOOM4_CUTOFF     1200
+#define MP_DEFAULT_SQR_TOOM4_CUTOFF     1400
+#define MP_DEFAULT_MUL_FFT_CUTOFF       12000
+#define MP_DEFAULT_SQR_FFT_CUTOFF       11000
+#define MP_DEFAULT_DIV_NEWTON_CUTOFF    20
@@ -6,6 +6,14 @@
 
 #include "tommath.h"
 #include "tommath_class.h"
+
+/* the AVX-512 IFMA kernels need a compiler which can target them per function,
+ * the CPU is checked at runtime, see s_mp_kernels()
+ */
+#if !(defined(__x86_64__) && (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5))))
+#   undef S_MP_EXPTMOD_IFMA_C
+#   undef S_MP_EXPTMOD4_AVX2_C
+#endif
 #include <limits.h>
 
 /*
@@ -86,6 +94,11 @@ do {                                                    \
 #  define MP_SQR_KARATSUBA_CUTOFF MP_DEFAULT_SQR_KARATSUBA_CUTOFF
 #  define MP_MUL_TOOM_CUTOFF      MP_DEFAULT_MUL_TOOM_CUTOFF
 #  define MP_SQR_TOOM_CUTOFF      MP_DEFAULT_SQR_TOOM_CUTOFF
+#  define MP_MUL_TOOM4_CUTOFF     MP_DEFAULT_MUL_TOOM4_CUTOFF
+#  define MP_SQR_TOOM4_CUTOFF     MP_DEFAULT_SQR_TOOM4_CUTOFF
+#  define MP_MUL_FFT_CUTOFF       MP_DEFAULT_MUL_FFT_CUTOFF
+#  define MP_SQR_FFT_CUTOFF       MP_DEFAULT_SQR_FFT_CUTOFF
+#  define MP_DIV_NEWTON_CUTOFF    MP_DEFAULT_DIV_NEWTON_CUTOFF
 #endif
 
 /* define heap macros */
@@ -140,6 +153,61 @@ typedef uint64_t mp_word;
 
 MP_STATIC_ASSERT(correct_word_size, sizeof(mp_word) == (2u * sizeof(mp_digit)))
 
+/* s_mp_mul_fft cuts the digits into coefficients of at most 32 bits and
+ * supports transforms with up to 2^MP_FFT_MAX_LOG coefficients.
+ */
+#if MP_DIGIT_BIT > 32
+#   define MP_FFT_BITS          (MP_DIGIT_BIT / 2)
+#else
+#   define MP_FFT_BITS          MP_DIGIT_BIT
+#endif
+#define MP_FFT_PER_DIGIT        (MP_DIGIT_BIT / MP_FFT_BITS)
+#define MP_FFT_MASK             ((((mp_digit)1)<<((mp_digit)MP_FFT_BITS))-((mp_digit)1))
+#define MP_FFT_MAX_LOG          26
+#define MP_FFT_MAX_DIGITS       ((1 << MP_FFT_MAX_LOG) / MP_FFT_PER_DIGIT)
+
+/* s_mp_exptmod_ifma accumulates without carry propagation, the lanes
+ * limit the size of the modulus to about 8192 bits.
+ */
+#define MP_IFMA_MIN_BITS        1024
+#define MP_IFMA_MAX_BITS        8192
+
+/* s_mp_exptmod4_avx2 does the same with 28 bit limbs in 64 bit lanes, which
+ * limits the moduli to about 3300 bits.  Four exponentiations at once are
+ * faster than four of the portable code at all sizes, but faster than four
+ * of s_mp_exptmod_ifma only up to MP_AVX2_IFMA_BITS.
+ */
+#define MP_AVX2_MAX_BITS        3072
+#define MP_AVX2_IFMA_BITS       1024
+
+/* mp_exptmod passes exponents of up to 32 bits with at most this many ones
+ * to mp_exptmod_d, which does the square and multiply itself only up to
+ * MP_EXPTMOD_SHORT_KERNEL_BITS if there is a kernel for the modulus
+ */
+#define MP_EXPTMOD_SHORT_ONES(bits)    (1 + ((bits) / 4))
+#define MP_EXPTMOD_SHORT_KERNEL_BITS   5
+
+/* mp_div_ctx_init keeps a reciprocal for divisors of at least this many digits */
+#define MP_DIV_CTX_MIN_DIGITS   8
+
+/* mp_div_d multiplies with a reciprocal of the divisor from this many digits of the
+ * dividend on, without the quotient a remainder needs no more than a fold of the digits
+ */
+#define MP_DIV_D_RECIP_MIN_DIGITS  16
+#define MP_MOD_D_RECIP_MIN_DIGITS  8
+
+/* mp_divexact lifts an inverse of the divisor if it and the quotient have at least
+ * this many digits, and one of them twice as many or both 16 times as many
+ */
+#define MP_DIVEXACT_HENSEL_MIN_DIGITS  32
+
+/* largest number of teeth of a fixed-base comb, the table has 2**teeth entries */
+#ifndef MP_LOW_MEM
+#   define MP_FIXED_BASE_MAX_TEETH 8
+#else
+#   define MP_FIXED_BASE_MAX_TEETH 5
+#endif
+
 /* default number of digits */
 #ifndef MP_DEFAULT_DIGIT_COUNT
 #   ifndef MP_LOW_MEM
@@ -174,17 +242,74 @@ MP_STATIC_ASSERT(prec_geq_min_prec, MP_DEFAULT_DIGIT_COUNT >= MP_MIN_DIGIT_COUNT
 /* random number source */
 extern MP_PRIVATE mp_err(*s_mp_rand_source)(void *out, size_t size);
 
+/* Kernels chosen at runtime for the host CPU. A NULL exptmod means that
+ * s_mp_exptmod_fast does the Montgomery exponentiation itself, otherwise
+ * exptmod handles odd moduli of exptmod_min_bits to exptmod_max_bits bits.
+ * If exptmod4 is not NULL mp_exptmod_batch does four jobs at once with odd
+ * moduli of up to exptmod4_max_bits bits.
+ */
+typedef struct {
+   mp_err(*exptmod)(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y);
+   int exptmod_min_bits, exptmod_max_bits;
+   mp_err(*exptmod4)(const mp_int *const G[], const mp_int *const X[], const mp_int *const P[], mp_int *const Y[]);
+   int exptmod4_max_bits;
+   const char *name[MP_KERNEL_EXPTMOD4 + 1];
+} mp_kernel_table;
+
+/* single digit reduction of the exponentiations, see s_mp_exptmod_setup */
+typedef mp_err(*mp_redux_fn)(mp_int *x, const mp_int *n, mp_digit rho);
+
+/* A prime mp_reduce_special knows, in words of 32 bits.  If terms is not
+ * NULL every word of the result is a sum of input words (Solinas), else the
+ * prime is 2**bits - (c1 * 2**32 + c0) with c0 < 2**31 and c1 <= 1.
+ */
+#define MP_SPECIAL_WORDS 17
+typedef struct {
+   int bits;
+   uint32_t p[MP_SPECIAL_WORDS];
+   const signed char *terms;
+   uint32_t c0, c1;
+} mp_special_prime;
+
+/* A single digit divisor shifted up by shift to the top bit of a digit and its
+ * reciprocal v = (beta**2 - 1) / d - beta for quotients.  For remainders by
+ * divisors below beta / 4 the bi are beta**i mod the divisor, else zero, see
+ * s_mp_div_d_recip.
+ */
+typedef struct {
+   mp_digit d, v;
+   int shift;
+   mp_digit b1, b2, b3;
+} mp_digit_recip;
+
+/* work item of s_mp_parallel */
+typedef void (*mp_task_fn)(void *arg);
+
 /* lowlevel functions, do not call! */
 MP_PRIVATE bool s_mp_get_bit(const mp_int *a, int b) MP_WUR;
 MP_PRIVATE int s_mp_log_2expt(const mp_int *a, mp_digit base) MP_WUR;
 MP_PRIVATE int s_mp_log_d(mp_digit base, mp_digit n) MP_WUR;
+MP_PRIVATE const mp_kernel_table *s_mp_kernels(void) MP_WUR;
+MP_PRIVATE const mp_special_prime *s_mp_special_prime(mp_digit i) MP_WUR;
 MP_PRIVATE mp_err s_mp_add(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_3(const mp_int *a, mp_int *c, mp_digit *d) MP_WUR;
+MP_PRIVATE mp_err s_mp_div_d_recip(const mp_int *a, const mp_digit_recip *r, mp_int *c, mp_digit *d) MP_WUR;
+MP_PRIVATE mp_err s_mp_div_newton(const mp_int *a, const mp_int *b, const mp_int *v, mp_int *c, mp_int *d) MP_WUR;
+MP_PRIVATE mp_err s_mp_div_recip(const mp_int *b, mp_int *v) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_recursive(const mp_int *a, const mp_int *b, mp_int *q, mp_int *r) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_school(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d) MP_WUR;
 MP_PRIVATE mp_err s_mp_div_small(const mp_int *a, const mp_int *b, mp_int *c, mp_int *d) MP_WUR;
+MP_PRIVATE mp_err s_mp_divexact_hensel(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_divexact_school(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_exptmod(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_even(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y) MP_WUR;
 MP_PRIVATE mp_err s_mp_exptmod_fast(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y, int redmode) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_table(mp_int *M, int winsize, int digits, void **mem, size_t *size) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_setup(const mp_int *P, int redmode, mp_redux_fn *redux, mp_digit *rho) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod_ifma(const mp_int *G, const mp_int *X, const mp_int *P, mp_int *Y) MP_WUR;
+MP_PRIVATE mp_err s_mp_exptmod4_avx2(const mp_int *const G[], const mp_int *const X[], const mp_int *const P[],
+                                     mp_int *const Y[]) MP_WUR;
+MP_PRIVATE mp_err s_mp_fixed_base_get(const mp_fixed_base *fb, int i, mp_int *a) MP_WUR;
 MP_PRIVATE mp_err s_mp_invmod(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_invmod_odd(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_log(const mp_int *a, mp_digit base, int *c) MP_WUR;
@@ -192,18 +317,28 @@ MP_PRIVATE mp_err s_mp_montgomery_reduce_comba(mp_int *x, const mp_int *n, mp_di
 MP_PRIVATE mp_err s_mp_mul(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_balance(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_fft(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_high(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_high_comba(const mp_int *a, const mp_int *b, mp_int *c, int digs) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_karatsuba(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_mulders(const mp_int *a, const mp_int *b, mp_int *c, int n) MP_WUR;
 MP_PRIVATE mp_err s_mp_mul_toom(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom32(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom4(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
+MP_PRIVATE mp_err s_mp_mul_toom43(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE mp_err s_mp_prime_is_divisible(const mp_int *a, bool *result) MP_WUR;
 MP_PRIVATE mp_err s_mp_rand_platform(void *p, size_t n) MP_WUR;
 MP_PRIVATE mp_err s_mp_sqr(const mp_int *a, mp_int *b) MP_WUR;
 MP_PRIVATE mp_err s_mp_sqr_comba(const mp_int *a, mp_int *b) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_fft(const mp_int *a, mp_int *b) MP_WUR;
 MP_PRIVATE mp_err s_mp_sqr_karatsuba(const mp_int *a, mp_int *b) MP_WUR;
 MP_PRIVATE mp_err s_mp_sqr_toom(const mp_int *a, mp_int *b) MP_WUR;
+MP_PRIVATE mp_err s_mp_sqr_toom4(const mp_int *a, mp_int *b) MP_WUR;
 MP_PRIVATE mp_err s_mp_sub(const mp_int *a, const mp_int *b, mp_int *c) MP_WUR;
 MP_PRIVATE void s_mp_copy_digs(mp_digit *d, const mp_digit *s, int digits);
+MP_PRIVATE void s_mp_digit_recip(mp_digit b, mp_digit_recip *r);
+MP_PRIVATE void s_mp_fixed_base_set(mp_fixed_base *fb, int i, const mp_int *a);
+MP_PRIVATE void s_mp_parallel(mp_task_fn fn, void *args, size_t size, int n, int threads);
 MP_PRIVATE void s_mp_zero_buf(void *mem, size_t size);
 MP_PRIVATE void s_mp_zero_digs(mp_digit *d, int digits);
 MP_PRIVATE mp_err s_mp_radix_size_overestimate(const mp_int *a, const int radix, size_t *size);
@@ -216,10 +351,14 @@ MP_PRIVATE void s_mp_rand_jenkins_init(uint64_t seed);
 extern MP_PRIVATE const char s_mp_radix_map[];
 extern MP_PRIVATE const uint8_t s_mp_radix_map_reverse[];
 extern MP_PRIVATE const mp_digit s_mp_prime_tab[];
+extern MP_PRIVATE const mp_digit_recip s_mp_prime_recip_tab[];
 
 /* number of primes */
 #define MP_PRIME_TAB_SIZE 256
 
+/* trial division by them goes through mp_mod_d_multi from this many digits on */
+#define MP_PRIME_TAB_MULTI_DIGITS 8
+
 #define MP_GET_ENDIANNESS(x) \
    do{\
       int16_t n = 0x1;                                          \